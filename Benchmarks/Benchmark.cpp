@@ -0,0 +1,297 @@
+#include "Benchmark.h"
+#include "../Sources/Editor/Commands.h"
+#include "../Sources/Editor/HierarchyWindowView.h"
+#include "../Sources/Editor/AttributeWindowView.h"
+#include "../Sources/Editor/ConvexDecomposition.h"
+#include "../Sources/Editor/CollisionAnalyzer.h"
+#include "../Sources/Gui/Helper.h"
+
+#include <Urho3D/Engine/Engine.h>
+#include <Urho3D/Engine/EngineDefs.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/VectorBuffer.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/Math/Random.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Resource/JSONFile.h>
+#include <Urho3D/UI/UI.h>
+
+using namespace Urho3D;
+using namespace Geode;
+
+static const unsigned DEFAULT_ITERATIONS = 10;
+static const unsigned DEFAULT_SCENE_SIZES[] = { 1000, 10000 };
+static const String DEFAULT_OUTPUT_FILENAME = "benchmark.json";
+static const unsigned DEFAULT_SEED = 1;
+static const unsigned DEFAULT_MAX_DEPTH = 1;
+static const unsigned QUERIES_PER_ITERATION = 1000;
+static const unsigned DECOMPOSITION_OUTLINE_SIZES[] = { 100, 1000, 10000 };
+
+Benchmark::Benchmark(Context* context) : Application(context)
+{
+	iterations_ = DEFAULT_ITERATIONS;
+	seed_ = DEFAULT_SEED;
+	maxDepth_ = DEFAULT_MAX_DEPTH;
+	outputFilename_ = DEFAULT_OUTPUT_FILENAME;
+}
+
+void Benchmark::Setup()
+{
+	engineParameters_[EP_HEADLESS] = true;
+	engineParameters_[EP_SOUND] = false;
+	engineParameters_[EP_LOG_LEVEL] = LOG_WARNING;
+
+	if (!engineParameters_.Contains(EP_RESOURCE_PREFIX_PATHS))
+	{
+		engineParameters_[EP_RESOURCE_PREFIX_PATHS] = ";Resources";
+	}
+
+	ParseArguments();
+}
+
+void Benchmark::Start()
+{
+	auto fileSystem = GetSubsystem<FileSystem>();
+	auto uiRoot = GetSubsystem<UI>()->GetRoot();
+	uiRoot->SetDefaultStyle(GetSubsystem<ResourceCache>()->GetResource<XMLFile>("UI/DefaultStyle.xml"));
+
+	Helper::RegisterObjects(context_);
+	EditorScene::RegisterObject(context_);
+
+	workingDir_ = fileSystem->GetAppPreferencesDir("urho3d", "benchmark");
+	editorScene_ = MakeShared<EditorScene>(context_);
+	generator_ = MakeShared<SceneGenerator>(context_);
+	generator_->SetSeed(seed_);
+	generator_->SetMaxDepth(maxDepth_);
+
+	for (auto numNodes : sceneSizes_)
+	{
+		RunScene(numNodes);
+	}
+
+	for (auto numVertices : DECOMPOSITION_OUTLINE_SIZES)
+	{
+		RunDecomposition(numVertices);
+	}
+
+	if (!SaveResults(outputFilename_))
+	{
+		ErrorExit("Failed to write benchmark results to " + outputFilename_);
+		return;
+	}
+
+	engine_->Exit();
+}
+
+void Benchmark::ParseArguments()
+{
+	auto arguments = GetArguments();
+
+	for (unsigned i = 0; i + 1 < arguments.Size(); i++)
+	{
+		auto argument = arguments[i].ToLower();
+		auto value = arguments[i + 1];
+
+		if (argument == "-size")
+		{
+			sceneSizes_.Push(ToUInt(value));
+			i++;
+		}
+		else if (argument == "-iterations")
+		{
+			iterations_ = Max(ToUInt(value), 1U);
+			i++;
+		}
+		else if (argument == "-seed")
+		{
+			seed_ = ToUInt(value);
+			i++;
+		}
+		else if (argument == "-depth")
+		{
+			maxDepth_ = ToUInt(value);
+			i++;
+		}
+		else if (argument == "-output")
+		{
+			outputFilename_ = value;
+			i++;
+		}
+	}
+
+	if (sceneSizes_.Empty())
+	{
+		for (auto size : DEFAULT_SCENE_SIZES)
+		{
+			sceneSizes_.Push(size);
+		}
+	}
+}
+
+void Benchmark::RunScene(unsigned numNodes)
+{
+	auto xmlFilename = workingDir_ + "Scene" + String(numNodes) + ".xml";
+	auto binaryFilename = workingDir_ + "Scene" + String(numNodes) + ".bin";
+
+	generator_->SetNumNodes(numNodes);
+
+	editorScene_->ClearSelection();
+	editorScene_->SetBlockEvents(true);
+	generator_->Generate(editorScene_);
+	editorScene_->SetBlockEvents(false);
+	editorScene_->GetSpatialIndex()->MarkDirty();
+
+	// Load & save.
+	// ----------------------------------------------------------------------------------------------------------------
+	Measure("EditorScene::Save(xml)", numNodes, [&](unsigned) { editorScene_->Save(xmlFilename); });
+	Measure("EditorScene::Save(bin)", numNodes, [&](unsigned) { editorScene_->Save(binaryFilename); });
+	Measure("EditorScene::Load(xml)", numNodes, [&](unsigned) { editorScene_->Load(xmlFilename); });
+	Measure("EditorScene::Load(bin)", numNodes, [&](unsigned) { editorScene_->Load(binaryFilename); });
+
+	// Snapshots.
+	// ----------------------------------------------------------------------------------------------------------------
+	auto snapshot = MakeShared<SceneSnapshot>(context_);
+	VectorBuffer buffer;
+
+	Measure("SceneSnapshot::Capture", numNodes, [&](unsigned) { snapshot->Capture(editorScene_); });
+	Measure("EditorScene::RestoreSnapshot(unchanged)", numNodes, [&](unsigned) { editorScene_->RestoreSnapshot(snapshot); });
+
+	for (auto& child : editorScene_->GetChildren())
+	{
+		child->SetPosition2D(child->GetPosition2D() + Vector2::ONE);
+	}
+
+	// Every iteration swaps the scene between both snapshots, so all the transforms differ.
+	auto movedSnapshot = editorScene_->CreateSnapshot();
+	Measure("EditorScene::RestoreSnapshot(moved)", numNodes, [&](unsigned i) { editorScene_->RestoreSnapshot(i % 2 == 0 ? snapshot : movedSnapshot); });
+	editorScene_->RestoreSnapshot(snapshot);
+
+	// Full reload from memory, the alternative to an in place restore.
+	editorScene_->Scene::Save(buffer);
+	Measure("Scene::Load(memory)", numNodes, [&](unsigned)
+	{
+		buffer.Seek(0);
+		editorScene_->SetBlockEvents(true);
+		editorScene_->Scene::Load(buffer);
+		editorScene_->SetBlockEvents(false);
+	});
+	editorScene_->GetSpatialIndex()->MarkDirty();
+
+	// Picking.
+	// ----------------------------------------------------------------------------------------------------------------
+	auto spatialIndex = editorScene_->GetSpatialIndex();
+	auto extent = Sqrt((float)numNodes) * generator_->GetSpacing();
+
+	Measure("EditorSpatialIndex::Rebuild", numNodes, [&](unsigned) { spatialIndex->MarkDirty(); spatialIndex->GetNumEntries(); });
+
+	SetRandomSeed(seed_);
+	Measure("EditorScene::GetNodeAt(x" + String(QUERIES_PER_ITERATION) + ")", numNodes, [&](unsigned)
+	{
+		for (unsigned i = 0; i < QUERIES_PER_ITERATION; i++)
+		{
+			editorScene_->GetNodeAt(Vector2(Random(extent), Random(extent)));
+		}
+	});
+
+	// Collision analysis.
+	// ----------------------------------------------------------------------------------------------------------------
+	auto collisionAnalyzer = MakeShared<CollisionAnalyzer>(context_);
+
+	// The first iteration builds the tree, the next ones only move the proxies.
+	Measure("CollisionAnalyzer::Analyze", numNodes, [&](unsigned) { collisionAnalyzer->Analyze(editorScene_); });
+
+	// Views.
+	// ----------------------------------------------------------------------------------------------------------------
+	auto commandHistory = MakeShared<CommandHistory>(iterations_);
+	auto hierarchyWindowView = MakeShared<HierarchyWindowView>(context_, commandHistory, editorScene_);
+	auto attributeWindowView = MakeShared<AttributeWindowView>(context_, commandHistory, editorScene_);
+	auto firstNode = editorScene_->GetChildren()[0].Get();
+	auto firstComponent = firstNode->GetComponents()[0].Get();
+
+	Measure("HierarchyWindowView::UpdateHierarchyList", numNodes, [&](unsigned) { hierarchyWindowView->UpdateHierarchyList(); });
+	Measure("AttributeWindowView::SetSelectedSerializable", numNodes, [&](unsigned i)
+	{
+		attributeWindowView->SetSelectedSerializable(i % 2 == 0 ? static_cast<Serializable*>(firstNode) : firstComponent);
+	});
+
+	// Commands.
+	// ----------------------------------------------------------------------------------------------------------------
+	PODVector<Node*> nodes;
+	Vector<NodeTransform2D> previousTransforms;
+	Vector<NodeTransform2D> transforms;
+
+	for (auto& child : editorScene_->GetChildren())
+	{
+		auto transform = TransformNodesCommand::GetWorldTransform(child);
+		nodes.Push(child);
+		previousTransforms.Push(transform);
+
+		transform.position += Vector2::ONE;
+		transforms.Push(transform);
+	}
+
+	auto command = MakeShared<TransformNodesCommand>(editorScene_, nodes, previousTransforms, transforms);
+	Measure("TransformNodesCommand::Exec", numNodes, [&](unsigned) { command->Exec(); });
+	Measure("TransformNodesCommand::Undo", numNodes, [&](unsigned) { command->Undo(); });
+
+	auto fileSystem = GetSubsystem<FileSystem>();
+	fileSystem->Delete(xmlFilename);
+	fileSystem->Delete(binaryFilename);
+}
+
+void Benchmark::RunDecomposition(unsigned numVertices)
+{
+	auto decomposition = MakeShared<ConvexDecomposition>(context_);
+	PODVector<Vector2> star;
+	PODVector<Vector2> blob;
+	PODVector<Vector2> circle;
+	Vector<PODVector<Vector2>> pieces;
+
+	// A star has every other vertex reflex, the worst case for ear clipping. A noisy blob is closer to traced sprites.
+	// A circle has no reflex vertex but a large bounding box per ear, it covers the convex fast path.
+	SetRandomSeed(seed_);
+
+	for (unsigned i = 0; i < numVertices; i++)
+	{
+		auto angle = 360.0f * i / numVertices;
+		auto starRadius = i % 2 == 0 ? 1.0f : 0.5f;
+		auto blobRadius = Random(0.8f, 1.0f);
+
+		star.Push(Vector2(Cos(angle), Sin(angle)) * starRadius);
+		blob.Push(Vector2(Cos(angle), Sin(angle)) * blobRadius);
+		circle.Push(Vector2(Cos(angle), Sin(angle)));
+	}
+
+	// The vertex count is reported in the "nodes" column.
+	Measure("ConvexDecomposition::Decompose(star)", numVertices, [&](unsigned) { decomposition->Decompose(star, pieces); });
+	Measure("ConvexDecomposition::Decompose(blob)", numVertices, [&](unsigned) { decomposition->Decompose(blob, pieces); });
+	Measure("ConvexDecomposition::Decompose(circle)", numVertices, [&](unsigned) { decomposition->Decompose(circle, pieces); });
+}
+
+bool Benchmark::SaveResults(const String& filename)
+{
+	JSONFile json(context_);
+	JSONValue& root = json.GetRoot();
+	JSONValue results;
+
+	for (auto& result : results_)
+	{
+		JSONValue value;
+		value.Set("name", result.name);
+		value.Set("nodes", result.numNodes);
+		value.Set("iterations", result.iterations);
+		value.Set("meanUs", result.meanUs);
+		value.Set("minUs", result.minUs);
+		value.Set("maxUs", result.maxUs);
+		results.Push(value);
+	}
+
+	root.Set("version", 1);
+	root.Set("results", results);
+
+	File file(context_, filename, FILE_WRITE);
+	return file.IsOpen() && json.Save(file);
+}
+
+URHO3D_DEFINE_APPLICATION_MAIN(Benchmark)
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../Sources/Editor/EditorScene.h"
+#include "../Sources/Editor/SceneGenerator.h"
+
+#include <Urho3D/Engine/Application.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Core/ProcessUtils.h>
+
+class Benchmark : public Urho3D::Application
+{
+	URHO3D_OBJECT(Benchmark, Urho3D::Application)
+
+	struct Result {
+		Urho3D::String name;
+		unsigned numNodes;
+		unsigned iterations;
+		double meanUs;
+		double minUs;
+		double maxUs;
+	};
+
+public:
+	explicit Benchmark(Urho3D::Context* context);
+
+	void Setup() override;
+	void Start() override;
+
+private:
+	void ParseArguments();
+	void RunScene(unsigned numNodes);
+	void RunDecomposition(unsigned numVertices);
+	bool SaveResults(const Urho3D::String& filename);
+	template<typename T> void Measure(const Urho3D::String& name, unsigned numNodes, T function);
+
+private:
+	Urho3D::SharedPtr<Geode::EditorScene> editorScene_;
+	Urho3D::SharedPtr<Geode::SceneGenerator> generator_;
+	Urho3D::PODVector<unsigned> sceneSizes_;
+	unsigned iterations_;
+	unsigned seed_;
+	unsigned maxDepth_;
+	Urho3D::String outputFilename_;
+	Urho3D::String workingDir_;
+	Urho3D::Vector<Result> results_;
+};
+
+template<typename T>
+void Benchmark::Measure(const Urho3D::String& name, unsigned numNodes, T function)
+{
+	Urho3D::HiresTimer timer;
+	Result result;
+	result.name = name;
+	result.numNodes = numNodes;
+	result.iterations = iterations_;
+	result.meanUs = 0.0;
+	result.minUs = Urho3D::M_INFINITY;
+	result.maxUs = 0.0;
+
+	for (unsigned i = 0; i < iterations_; i++)
+	{
+		timer.Reset();
+		function(i);
+
+		auto elapsed = (double)timer.GetUSec(false);
+		result.meanUs += elapsed / iterations_;
+		result.minUs = Urho3D::Min(result.minUs, elapsed);
+		result.maxUs = Urho3D::Max(result.maxUs, elapsed);
+	}
+
+	Urho3D::PrintLine(name + " [" + Urho3D::String(numNodes) + " nodes] mean " + Urho3D::String(result.meanUs) + "us, min " + Urho3D::String(result.minUs) + "us, max " + Urho3D::String(result.maxUs) + "us");
+	results_.Push(result);
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "AnchorBox.h"
 #include "AnchorBoxEvents.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/Scene/SceneEvents.h>
@@ -57,11 +59,11 @@ namespace Geode
 		boxGeometry_->SetOccludee(false);
 		boxGeometry_->SetEnabled(false);
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(AnchorBox, HandleSceneUpdate));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, URHO3D_HANDLER(AnchorBox, HandleSceneViewDragBegin));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, URHO3D_HANDLER(AnchorBox, HandleSceneViewDragMove));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, URHO3D_HANDLER(AnchorBox, HandleSceneViewDragEnd));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, URHO3D_HANDLER(AnchorBox, HandleSceneViewDragCancel));
+		SubscribeToEvent(editorScene_, E_EDITORUPDATE, GEODE_HANDLER(AnchorBox, HandleEditorUpdate));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, GEODE_HANDLER(AnchorBox, HandleSceneViewDragBegin));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, GEODE_HANDLER(AnchorBox, HandleSceneViewDragMove));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, GEODE_HANDLER(AnchorBox, HandleSceneViewDragEnd));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, GEODE_HANDLER(AnchorBox, HandleSceneViewDragCancel));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -249,7 +251,7 @@ namespace Geode
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
-	void AnchorBox::HandleSceneUpdate(StringHash, VariantMap& eventData)
+	void AnchorBox::HandleEditorUpdate(StringHash, VariantMap& eventData)
 	{
 		UpdateRender();
 	}
@@ -280,6 +282,8 @@ namespace Geode
 
 	void AnchorBox::HandleSceneViewDragMove(StringHash, VariantMap& eventData)
 	{
+		GEODE_TRACE("AnchorBox::HandleSceneViewDragMove", "sceneview");
+
 		if (!enabled_ || !editing_ || selectedAnchorId_ == -1)
 		{
 			return;
@@ -396,6 +400,8 @@ namespace Geode
 
 	void AnchorBox::UpdateRender()
 	{
+		GEODE_TRACE("AnchorBox::UpdateRender", "overlay");
+
 		if (!enabled_)
 		{
 			boxGeometry_->SetEnabled(false);
@@ -64,7 +64,7 @@ namespace Geode
 
 	private:
 		/// Event handlers.
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
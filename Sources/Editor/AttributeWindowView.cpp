@@ -1,5 +1,7 @@
 #include "AttributeWindowView.h"
+#include "EditorProfiler.h"
 #include "../Gui/GuiEvents.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/UI/UIEvents.h>
 #include <Urho3D/Core/CoreEvents.h>
@@ -19,8 +21,8 @@ namespace Geode
 
 		SetSelectedSerializable(editorScene_->GetSelectedObjectAs<Serializable>());
 
-		SubscribeToEvent(editorScene, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(AttributeWindowView, HandleSelectedObjectChanged));
-		SubscribeToEvent(attributesForm_, E_REACTIVEFORM_DATACHANGED, URHO3D_HANDLER(AttributeWindowView, HandleReactiveFormDataChanged));
+		SubscribeToEvent(editorScene, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(AttributeWindowView, HandleSelectedObjectChanged));
+		SubscribeToEvent(attributesForm_, E_REACTIVEFORM_DATACHANGED, GEODE_HANDLER(AttributeWindowView, HandleReactiveFormDataChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -47,6 +49,8 @@ namespace Geode
 
 	void AttributeWindowView::SetSelectedSerializable(Serializable* selectedSerializable)
 	{
+		GEODE_PROFILE("Inspector");
+
 		if (selectedSerializable != nullptr)
 		{
 			auto attributes = selectedSerializable->GetAttributes();
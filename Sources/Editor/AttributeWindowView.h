@@ -27,14 +27,14 @@ namespace Geode
 		/// Constructors.
 		explicit AttributeWindowView(Urho3D::Context* context, Geode::CommandHistory::Ptr commandHistory, Geode::EditorScene::Ptr editorScene);
 
+		/// Accessors & Mutators.
+		void SetSelectedSerializable(Urho3D::Serializable* serializable);
+
 	private:
 		/// Event handlers.
 		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleReactiveFormDataChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
-		/// Accessors & Mutators.
-		void SetSelectedSerializable(Urho3D::Serializable* serializable);
-
 	private:
 		Geode::CommandHistory::Ptr commandHistory_;
 		Geode::EditorScene::Ptr editorScene_;
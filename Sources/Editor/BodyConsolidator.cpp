@@ -0,0 +1,101 @@
+#include "BodyConsolidator.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Container/HashSet.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/Urho2D/Constraint2D.h>
+
+using namespace Urho3D;
+
+static const unsigned MIN_NUM_BODIES = 2;
+
+namespace Geode
+{
+	BodyConsolidator::BodyConsolidator(Context* context) : Object(context)
+	{
+		numBodies_ = 0;
+		numShapes_ = 0;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	unsigned BodyConsolidator::GetNumBodies() const
+	{
+		return numBodies_;
+	}
+
+	unsigned BodyConsolidator::GetNumShapes() const
+	{
+		return numShapes_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	ICommand::Ptr BodyConsolidator::Consolidate(EditorScene::Ptr editorScene)
+	{
+		GEODE_TRACE("BodyConsolidator::Consolidate", "command");
+
+		auto rootNode = editorScene->GetSelectedNode() != nullptr ? editorScene->GetSelectedNode() : editorScene.Get();
+		PODVector<RigidBody2D*> bodies;
+		PODVector<Constraint2D*> constraints;
+		HashSet<RigidBody2D*> jointBodies;
+		PODVector<Node*> sourceNodes;
+
+		numBodies_ = 0;
+		numShapes_ = 0;
+		rootNode->GetComponents<RigidBody2D>(bodies, true);
+		editorScene->GetDerivedComponents<Constraint2D>(constraints, true);
+
+		// Joints hold on to their bodies, those have to stay where they are.
+		for (auto constraint : constraints)
+		{
+			jointBodies.Insert(constraint->GetNode()->GetComponent<RigidBody2D>());
+			jointBodies.Insert(constraint->GetOtherBody());
+		}
+
+		for (auto body : bodies)
+		{
+			if (body->GetBodyType() != BT_STATIC || !body->IsEnabledEffective() || jointBodies.Contains(body))
+			{
+				continue;
+			}
+
+			PODVector<CollisionShape2D*> shapes;
+			body->GetNode()->GetDerivedComponents<CollisionShape2D>(shapes);
+			numShapes_ += shapes.Size();
+			sourceNodes.Push(body->GetNode());
+		}
+
+		auto command = MakeShared<CompoundCommand>();
+
+		// An empty command does nothing and stays out of the history.
+		if (sourceNodes.Size() < MIN_NUM_BODIES)
+		{
+			return command;
+		}
+
+		// The shared body sits at the scene root without transform, shapes are placed in world space.
+		auto bodyNode = MakeShared<Node>(context_);
+		bodyNode->SetName("StaticBody");
+		bodyNode->CreateComponent<RigidBody2D>()->SetBodyType(BT_STATIC);
+
+		// Shapes being moved may be the edited selection.
+		command->Add(MakeShared<UnselectCommand>(editorScene));
+		command->Add(MakeShared<AttachNodeCommand>(editorScene, bodyNode, editorScene.Get()));
+
+		for (auto sourceNode : sourceNodes)
+		{
+			command->Add(MakeShared<MoveCollisionShapesCommand>(editorScene, sourceNode, bodyNode.Get()));
+		}
+
+		numBodies_ = sourceNodes.Size();
+		URHO3D_LOGINFO(ToString("Consolidating %u static bodies (%u shapes) into one, %u bodies eliminated", numBodies_, numShapes_, numBodies_ - 1));
+
+		return command;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+/**
+ * @file    BodyConsolidator.h
+ * @ingroup Editor
+ * @brief   Static bodies of a subtree folded into a single shared body.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "Commands.h"
+
+#include <Urho3D/Core/Context.h>
+
+namespace Geode
+{
+	class BodyConsolidator : public Urho3D::Object
+	{
+		URHO3D_OBJECT(BodyConsolidator, Urho3D::Object)
+
+	public:
+		using Ptr = Urho3D::SharedPtr<BodyConsolidator>;
+
+	public:
+		/// Constructors.
+		explicit BodyConsolidator(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		unsigned GetNumBodies() const;
+		unsigned GetNumShapes() const;
+
+		/// Other methods.
+		Geode::ICommand::Ptr Consolidate(Geode::EditorScene::Ptr editorScene);
+
+	private:
+		unsigned numBodies_;
+		unsigned numShapes_;
+	};
+}
\ No newline at end of file
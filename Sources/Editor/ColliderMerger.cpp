@@ -0,0 +1,419 @@
+#include "ColliderMerger.h"
+#include "CollisionShapeGeometry.h"
+
+#include <Urho3D/Container/Sort.h>
+#include <Urho3D/Urho2D/CollisionBox2D.h>
+#include <Urho3D/Urho2D/CollisionPolygon2D.h>
+
+using namespace Urho3D;
+
+/// Tile edges computed in floats are snapped, so abutting boxes share their coordinates exactly.
+static const float SNAP_SIZE = 1e-4f;
+static const float ALIGN_EPSILON = 1e-3f;
+static const int NUM_DIRECTIONS = 4;
+static const int DIRECTION_OFFSETS[NUM_DIRECTIONS][2] = { { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 } };
+
+static inline float Snap(float value)
+{
+	return Round(value / SNAP_SIZE) * SNAP_SIZE;
+}
+
+static void SortUnique(PODVector<float>& values)
+{
+	Sort(values.Begin(), values.End());
+	unsigned size = 0;
+
+	for (unsigned i = 0; i < values.Size(); i++)
+	{
+		if (size == 0 || values[i] != values[size - 1])
+		{
+			values[size++] = values[i];
+		}
+	}
+
+	values.Resize(size);
+}
+
+static unsigned FindCoordinate(const PODVector<float>& values, float value)
+{
+	unsigned first = 0;
+	unsigned last = values.Size();
+
+	while (first < last)
+	{
+		auto middle = (first + last) / 2;
+
+		if (values[middle] < value)
+		{
+			first = middle + 1;
+		}
+		else
+		{
+			last = middle;
+		}
+	}
+
+	return first;
+}
+
+namespace Geode
+{
+	ColliderMerger::ColliderMerger(Context* context) : Object(context)
+	{
+		useChains_ = false;
+		decomposition_ = MakeShared<ConvexDecomposition>(context_);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void ColliderMerger::SetUseChains(bool useChains)
+	{
+		useChains_ = useChains;
+	}
+
+	bool ColliderMerger::GetUseChains() const
+	{
+		return useChains_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void ColliderMerger::Merge(const PODVector<Rect>& rects, Vector<PODVector<Vector2>>& polygons, Vector<PODVector<Vector2>>& chains, PODVector<unsigned>& mergedRects)
+	{
+		polygons.Clear();
+		chains.Clear();
+		mergedRects.Clear();
+		rects_.Clear();
+
+		for (auto& rect : rects)
+		{
+			rects_.Push(Rect(Snap(rect.min_.x_), Snap(rect.min_.y_), Snap(rect.max_.x_), Snap(rect.max_.y_)));
+		}
+
+		FindComponents();
+
+		HashMap<unsigned, PODVector<unsigned>> components;
+
+		for (unsigned i = 0; i < rects_.Size(); i++)
+		{
+			components[FindRoot(i)].Push(i);
+		}
+
+		for (auto& component : components)
+		{
+			auto& rectIndices = component.second_;
+			Vector<PODVector<Vector2>> loops;
+
+			// A lone collider gains nothing from being rebuilt.
+			if (rectIndices.Size() < 2)
+			{
+				continue;
+			}
+
+			auto hasHoles = TraceComponent(rectIndices, loops);
+
+			// Box2D polygons can't have holes, such regions are kept as chain loops whatever the setting.
+			if (useChains_ || hasHoles)
+			{
+				chains.Push(loops);
+			}
+			else
+			{
+				Vector<PODVector<Vector2>> componentPolygons;
+				auto decomposed = true;
+
+				for (auto& loop : loops)
+				{
+					Vector<PODVector<Vector2>> pieces;
+					decomposed = decomposed && decomposition_->Decompose(loop, pieces);
+					componentPolygons.Push(pieces);
+				}
+
+				// An outline the decomposition rejects would lose its collision, its colliders are left as they are.
+				if (!decomposed)
+				{
+					continue;
+				}
+
+				polygons.Push(componentPolygons);
+			}
+
+			mergedRects.Push(rectIndices);
+		}
+	}
+
+	bool ColliderMerger::GetWorldRect(CollisionShape2D* shape, Rect& dest)
+	{
+		PODVector<Vector2> corners;
+		auto closed = false;
+		auto isBox = shape->IsInstanceOf<CollisionBox2D>();
+		auto isQuad = shape->IsInstanceOf<CollisionPolygon2D>() && static_cast<CollisionPolygon2D*>(shape)->GetVertexCount() == 4;
+
+		if ((!isBox && !isQuad) || !CollisionShapeGeometry::GetWorldOutline(shape, corners, closed))
+		{
+			return false;
+		}
+
+		dest = Rect(Vector2(M_INFINITY, M_INFINITY), Vector2(-M_INFINITY, -M_INFINITY));
+
+		for (auto& corner : corners)
+		{
+			dest.Merge(corner);
+		}
+
+		auto size = dest.Size();
+
+		if (size.x_ <= ALIGN_EPSILON || size.y_ <= ALIGN_EPSILON)
+		{
+			return false;
+		}
+
+		// Axis-aligned when each corner sits on a distinct corner of the bounds.
+		unsigned cornerMask = 0;
+
+		for (auto& corner : corners)
+		{
+			auto onMinX = Abs(corner.x_ - dest.min_.x_) <= ALIGN_EPSILON;
+			auto onMaxX = Abs(corner.x_ - dest.max_.x_) <= ALIGN_EPSILON;
+			auto onMinY = Abs(corner.y_ - dest.min_.y_) <= ALIGN_EPSILON;
+			auto onMaxY = Abs(corner.y_ - dest.max_.y_) <= ALIGN_EPSILON;
+
+			if (!(onMinX || onMaxX) || !(onMinY || onMaxY))
+			{
+				return false;
+			}
+
+			cornerMask |= 1 << ((onMaxX ? 1 : 0) + (onMaxY ? 2 : 0));
+		}
+
+		return cornerMask == 15;
+	}
+
+	void ColliderMerger::FindComponents()
+	{
+		auto cellSize = 0.0f;
+		parents_.Resize(rects_.Size());
+		cells_.Clear();
+
+		for (unsigned i = 0; i < rects_.Size(); i++)
+		{
+			auto size = rects_[i].Size();
+			parents_[i] = i;
+			cellSize += Max(size.x_, size.y_);
+		}
+
+		// Tiles share a size, so the mean extent keeps every rect in a few cells.
+		cellSize = Max(cellSize / Max(rects_.Size(), 1U), SNAP_SIZE);
+
+		for (unsigned i = 0; i < rects_.Size(); i++)
+		{
+			auto& rect = rects_[i];
+			auto minCell = IntVector2(FloorToInt((rect.min_.x_ - SNAP_SIZE) / cellSize), FloorToInt((rect.min_.y_ - SNAP_SIZE) / cellSize));
+			auto maxCell = IntVector2(FloorToInt((rect.max_.x_ + SNAP_SIZE) / cellSize), FloorToInt((rect.max_.y_ + SNAP_SIZE) / cellSize));
+
+			for (auto y = minCell.y_; y <= maxCell.y_; y++)
+			{
+				for (auto x = minCell.x_; x <= maxCell.x_; x++)
+				{
+					auto& cell = cells_[IntVector2(x, y)];
+
+					// Joined when they share an edge span or overlap, touching corners keep regions apart.
+					for (auto other : cell)
+					{
+						auto& otherRect = rects_[other];
+						auto overlapX = Min(rect.max_.x_, otherRect.max_.x_) - Max(rect.min_.x_, otherRect.min_.x_);
+						auto overlapY = Min(rect.max_.y_, otherRect.max_.y_) - Max(rect.min_.y_, otherRect.min_.y_);
+
+						if (overlapX >= 0.0f && overlapY >= 0.0f && (overlapX > SNAP_SIZE || overlapY > SNAP_SIZE))
+						{
+							parents_[FindRoot(i)] = FindRoot(other);
+						}
+					}
+
+					cell.Push(i);
+				}
+			}
+		}
+	}
+
+	unsigned ColliderMerger::FindRoot(unsigned index)
+	{
+		while (parents_[index] != index)
+		{
+			parents_[index] = parents_[parents_[index]];
+			index = parents_[index];
+		}
+
+		return index;
+	}
+
+	bool ColliderMerger::TraceComponent(const PODVector<unsigned>& rectIndices, Vector<PODVector<Vector2>>& dest)
+	{
+		PODVector<float> xs;
+		PODVector<float> ys;
+		dest.Clear();
+
+		// The union is exact on the grid of the rect coordinates, a cell is either fully covered or empty.
+		for (auto index : rectIndices)
+		{
+			xs.Push(rects_[index].min_.x_);
+			xs.Push(rects_[index].max_.x_);
+			ys.Push(rects_[index].min_.y_);
+			ys.Push(rects_[index].max_.y_);
+		}
+
+		SortUnique(xs);
+		SortUnique(ys);
+
+		int numCornersX = xs.Size();
+		int numCornersY = ys.Size();
+		int numCellsX = numCornersX - 1;
+		int numCellsY = numCornersY - 1;
+		PODVector<int> coverage(numCornersX * numCornersY);
+		PODVector<unsigned char> directions(numCornersX * numCornersY);
+
+		for (auto& count : coverage)
+		{
+			count = 0;
+		}
+
+		for (auto& direction : directions)
+		{
+			direction = 0;
+		}
+
+		// Summed area of rect corners, then each cell holds how many rects cover it.
+		for (auto index : rectIndices)
+		{
+			int minX = FindCoordinate(xs, rects_[index].min_.x_);
+			int minY = FindCoordinate(ys, rects_[index].min_.y_);
+			int maxX = FindCoordinate(xs, rects_[index].max_.x_);
+			int maxY = FindCoordinate(ys, rects_[index].max_.y_);
+
+			coverage[minY * numCornersX + minX]++;
+			coverage[minY * numCornersX + maxX]--;
+			coverage[maxY * numCornersX + minX]--;
+			coverage[maxY * numCornersX + maxX]++;
+		}
+
+		for (int y = 0; y < numCornersY; y++)
+		{
+			for (int x = 0; x < numCornersX; x++)
+			{
+				auto& count = coverage[y * numCornersX + x];
+				count += (x > 0 ? coverage[y * numCornersX + x - 1] : 0) + (y > 0 ? coverage[(y - 1) * numCornersX + x] : 0) - (x > 0 && y > 0 ? coverage[(y - 1) * numCornersX + x - 1] : 0);
+			}
+		}
+
+		auto isCovered = [&](int x, int y) { return x >= 0 && y >= 0 && x < numCellsX && y < numCellsY && coverage[y * numCornersX + x] > 0; };
+
+		// Boundary edges keep the covered cell on their left, outer loops turn counterclockwise and holes clockwise.
+		for (int y = 0; y < numCellsY; y++)
+		{
+			for (int x = 0; x < numCellsX; x++)
+			{
+				if (!isCovered(x, y))
+				{
+					continue;
+				}
+
+				if (!isCovered(x, y - 1))
+				{
+					directions[y * numCornersX + x] |= 1;
+				}
+
+				if (!isCovered(x + 1, y))
+				{
+					directions[y * numCornersX + x + 1] |= 2;
+				}
+
+				if (!isCovered(x, y + 1))
+				{
+					directions[(y + 1) * numCornersX + x + 1] |= 4;
+				}
+
+				if (!isCovered(x - 1, y))
+				{
+					directions[(y + 1) * numCornersX + x] |= 8;
+				}
+			}
+		}
+
+		auto hasHoles = false;
+
+		for (int start = 0; start < numCornersX * numCornersY; start++)
+		{
+			while (directions[start] != 0)
+			{
+				PODVector<int> corners;
+				PODVector<int> cornerDirections;
+				auto corner = start;
+				auto direction = 0;
+
+				while ((directions[start] & (1 << direction)) == 0)
+				{
+					direction++;
+				}
+
+				do
+				{
+					directions[corner] &= ~(1 << direction);
+					corners.Push(corner);
+					cornerDirections.Push(direction);
+					corner += DIRECTION_OFFSETS[direction][1] * numCornersX + DIRECTION_OFFSETS[direction][0];
+
+					if (corner == start)
+					{
+						break;
+					}
+
+					// Left turn first, so regions touching at a corner are traced apart.
+					auto nextDirection = -1;
+
+					for (auto turn : { 1, 0, 3 })
+					{
+						auto candidate = (direction + turn) % NUM_DIRECTIONS;
+
+						if (directions[corner] & (1 << candidate))
+						{
+							nextDirection = candidate;
+							break;
+						}
+					}
+
+					direction = nextDirection;
+				}
+				while (direction != -1);
+
+				PODVector<Vector2> loop;
+				auto area = 0.0f;
+
+				// Only corners where the boundary turns are kept.
+				for (unsigned i = 0; i < corners.Size(); i++)
+				{
+					if (cornerDirections[i] != cornerDirections[(i + corners.Size() - 1) % corners.Size()])
+					{
+						loop.Push(Vector2(xs[corners[i] % numCornersX], ys[corners[i] / numCornersX]));
+					}
+				}
+
+				for (unsigned i = 0; i < loop.Size(); i++)
+				{
+					area += loop[i].CrossProduct(loop[(i + 1) % loop.Size()]);
+				}
+
+				if (loop.Size() >= 4)
+				{
+					hasHoles = hasHoles || area < 0.0f;
+					dest.Push(loop);
+				}
+			}
+		}
+
+		return hasHoles;
+	}
+}
\ No newline at end of file
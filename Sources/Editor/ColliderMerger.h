@@ -0,0 +1,54 @@
+/**
+ * @file    ColliderMerger.h
+ * @ingroup Editor
+ * @brief   Union of abutting axis-aligned static colliders into fewer polygon or chain outlines.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "ConvexDecomposition.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Math/Rect.h>
+#include <Urho3D/Urho2D/CollisionShape2D.h>
+
+namespace Geode
+{
+	class ColliderMerger : public Urho3D::Object
+	{
+		URHO3D_OBJECT(ColliderMerger, Urho3D::Object)
+
+	public:
+		using Ptr = Urho3D::SharedPtr<ColliderMerger>;
+
+	public:
+		/// Constructors.
+		explicit ColliderMerger(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetUseChains(bool useChains);
+		bool GetUseChains() const;
+
+		/// Other methods.
+		void Merge(const Urho3D::PODVector<Urho3D::Rect>& rects, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& polygons, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& chains, Urho3D::PODVector<unsigned>& mergedRects);
+		static bool GetWorldRect(Urho3D::CollisionShape2D* shape, Urho3D::Rect& dest);
+
+	private:
+		/// Other methods.
+		void FindComponents();
+		unsigned FindRoot(unsigned index);
+		bool TraceComponent(const Urho3D::PODVector<unsigned>& rectIndices, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& dest);
+
+	private:
+		bool useChains_;
+		Urho3D::PODVector<Urho3D::Rect> rects_;
+		Urho3D::PODVector<unsigned> parents_;
+		Urho3D::HashMap<Urho3D::IntVector2, Urho3D::PODVector<unsigned>> cells_;
+		Geode::ConvexDecomposition::Ptr decomposition_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "CollisionAnalysisWindowView.h"
+#include "EditorSceneEvents.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/UI/UIEvents.h>
+
+using namespace Urho3D;
+
+/// Enough to walk through by hand, the highlight still shows every issue.
+static const unsigned MAX_ROWS = 500;
+static const int HIGHLIGHT_Z_INDEX = -5;
+static const Color OVERLAP_COLOR = Color(1.0f, 0.6f, 0.0f);
+static const Color INVALID_COLOR = Color(1.0f, 0.1f, 0.1f);
+static const Color SELECTED_COLOR = Color(1.0f, 1.0f, 1.0f);
+static const String VAR_ISSUE_INDEX = "VAR_ISSUE_INDEX";
+
+static void DefineOutline(CustomGeometry* geometry, const PODVector<Vector2>& outline, bool closed, const Color& color)
+{
+	auto numEdges = closed ? outline.Size() : Max(outline.Size(), 1U) - 1;
+
+	for (unsigned i = 0; i < numEdges; i++)
+	{
+		geometry->DefineVertex(Vector3(outline[i], HIGHLIGHT_Z_INDEX));
+		geometry->DefineColor(color);
+		geometry->DefineVertex(Vector3(outline[(i + 1) % outline.Size()], HIGHLIGHT_Z_INDEX));
+		geometry->DefineColor(color);
+	}
+}
+
+namespace Geode
+{
+	CollisionAnalysisWindowView::CollisionAnalysisWindowView(Context* context, SceneView::Ptr sceneView) : IWindowView(context, "UI/CollisionAnalysisWindowView.xml")
+	{
+		sceneView_ = sceneView;
+		editorScene_ = sceneView->GetEditorScene();
+		analyzer_ = MakeShared<CollisionAnalyzer>(context_);
+		selectedIssue_ = M_MAX_UNSIGNED;
+
+		statusText_ = elRoot_->GetChildDynamicCast<Text>("StatusText", true);
+		assert(statusText_);
+
+		issuesList_ = elRoot_->GetChildDynamicCast<ListView>("IssuesList", true);
+		assert(issuesList_);
+
+		analyzeButton_ = elRoot_->GetChildDynamicCast<Button>("AnalyzeButton", true);
+		assert(analyzeButton_);
+
+		clearButton_ = elRoot_->GetChildDynamicCast<Button>("ClearButton", true);
+		assert(clearButton_);
+
+		// Drawn in world space, the node stays out of the scene so it's never saved.
+		highlightNode_ = MakeShared<Node>(context_);
+		highlightGeometry_ = highlightNode_->CreateComponent<CustomGeometry>();
+		highlightGeometry_->SetEnabled(false);
+
+		SubscribeToEvent(analyzeButton_, E_RELEASED, GEODE_HANDLER(CollisionAnalysisWindowView, HandleAnalyzeButtonReleased));
+		SubscribeToEvent(clearButton_, E_RELEASED, GEODE_HANDLER(CollisionAnalysisWindowView, HandleClearButtonReleased));
+		SubscribeToEvent(issuesList_, E_ITEMCLICKED, GEODE_HANDLER(CollisionAnalysisWindowView, HandleIssuesListItemClicked));
+		SubscribeToEvent(editorScene_, E_SCENELOADED, GEODE_HANDLER(CollisionAnalysisWindowView, HandleSceneLoaded));
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionAnalysisWindowView::Analyze()
+	{
+		analyzer_->Analyze(editorScene_.Get());
+		selectedIssue_ = M_MAX_UNSIGNED;
+
+		auto& issues = analyzer_->GetIssues();
+		auto text = ToString("%u shapes, %u pairs tested in %.1f ms\n%u issues", analyzer_->GetNumShapes(), analyzer_->GetNumPairs(), analyzer_->GetElapsedTime(), issues.Size());
+
+		if (issues.Size() > MAX_ROWS)
+		{
+			text += ToString(", first %u listed", MAX_ROWS);
+		}
+
+		statusText_->SetText(text);
+		UpdateIssuesList();
+		UpdateHighlight();
+	}
+
+	void CollisionAnalysisWindowView::Clear()
+	{
+		analyzer_->Clear();
+		selectedIssue_ = M_MAX_UNSIGNED;
+		statusText_->SetText("Not analyzed.");
+
+		UpdateIssuesList();
+		UpdateHighlight();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionAnalysisWindowView::HandleAnalyzeButtonReleased(StringHash, VariantMap&)
+	{
+		Analyze();
+	}
+
+	void CollisionAnalysisWindowView::HandleClearButtonReleased(StringHash, VariantMap&)
+	{
+		Clear();
+	}
+
+	void CollisionAnalysisWindowView::HandleIssuesListItemClicked(StringHash, VariantMap& eventData)
+	{
+		auto item = static_cast<UIElement*>(eventData[ItemClicked::P_ITEM].GetPtr());
+		auto index = item != nullptr ? item->GetVar(VAR_ISSUE_INDEX).GetUInt() : M_MAX_UNSIGNED;
+		auto& issues = analyzer_->GetIssues();
+
+		if (index >= issues.Size())
+		{
+			return;
+		}
+
+		auto& issue = issues[index];
+		selectedIssue_ = index;
+
+		// Shapes edited or removed since the analysis are still shown where they were.
+		if (issue.shape != nullptr)
+		{
+			editorScene_->SetSelectedObject(issue.shape.Get());
+		}
+
+		sceneView_->SetCameraPosition(issue.rect.Center());
+		UpdateHighlight();
+	}
+
+	void CollisionAnalysisWindowView::HandleSceneLoaded(StringHash, VariantMap&)
+	{
+		// The tree holds shapes of the previous scene.
+		Clear();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  UPDATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionAnalysisWindowView::UpdateIssuesList()
+	{
+		auto& issues = analyzer_->GetIssues();
+		issuesList_->RemoveAllItems();
+
+		for (unsigned i = 0; i < issues.Size() && i < MAX_ROWS; i++)
+		{
+			auto item = MakeShared<Text>(context_);
+			issuesList_->AddItem(item);
+
+			item->SetStyle("FileSelectorListText");
+			item->SetText(CollisionAnalyzer::GetDescription(issues[i]));
+			item->SetVar(VAR_ISSUE_INDEX, i);
+			item->SetColor(issues[i].type == CollisionAnalyzer::IssueType::OVERLAP ? OVERLAP_COLOR : INVALID_COLOR);
+		}
+	}
+
+	void CollisionAnalysisWindowView::UpdateHighlight()
+	{
+		auto& issues = analyzer_->GetIssues();
+
+		if (issues.Empty())
+		{
+			highlightGeometry_->SetEnabled(false);
+			return;
+		}
+
+		if (!highlightGeometry_->IsEnabled() && editorScene_->GetComponent<Octree>() != nullptr)
+		{
+			highlightGeometry_->SetEnabled(true);
+			editorScene_->GetComponent<Octree>()->AddManualDrawable(highlightGeometry_);
+		}
+
+		highlightGeometry_->Clear();
+		highlightGeometry_->SetNumGeometries(1);
+		highlightGeometry_->BeginGeometry(0, PrimitiveType::LINE_LIST);
+
+		for (unsigned i = 0; i < issues.Size(); i++)
+		{
+			auto& issue = issues[i];
+			auto color = i == selectedIssue_ ? SELECTED_COLOR : (issue.type == CollisionAnalyzer::IssueType::OVERLAP ? OVERLAP_COLOR : INVALID_COLOR);
+
+			DefineOutline(highlightGeometry_, issue.outline, issue.closed, color);
+			DefineOutline(highlightGeometry_, issue.otherOutline, true, color);
+		}
+
+		highlightGeometry_->SetMaterial(0, GetSubsystem<ResourceCache>()->GetResource<Material>("Materials/VColUnlit.xml"));
+		highlightGeometry_->Commit();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * @file    CollisionAnalysisWindowView.h
+ * @ingroup Editor
+ * @brief   WindowView listing overlapping and invalid collision shapes, highlighted in the scene view.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "CollisionAnalyzer.h"
+#include "SceneView.h"
+#include "../Gui/IWindowView.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Graphics/CustomGeometry.h>
+#include <Urho3D/UI/ListView.h>
+
+namespace Geode
+{
+	class CollisionAnalysisWindowView : public Geode::IWindowView
+	{
+		URHO3D_OBJECT(CollisionAnalysisWindowView, Geode::IWindowView)
+
+	public:
+		/// Constructors.
+		explicit CollisionAnalysisWindowView(Urho3D::Context* context, Geode::SceneView::Ptr sceneView);
+
+		/// Other methods.
+		void Analyze();
+		void Clear();
+
+	private:
+		/// Event handlers.
+		void HandleAnalyzeButtonReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleClearButtonReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleIssuesListItemClicked(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneLoaded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Update methods.
+		void UpdateIssuesList();
+		void UpdateHighlight();
+
+	private:
+		Geode::SceneView::Ptr sceneView_;
+		Geode::EditorScene::Ptr editorScene_;
+		Geode::CollisionAnalyzer::Ptr analyzer_;
+		Urho3D::Text* statusText_;
+		Urho3D::ListView* issuesList_;
+		Urho3D::Button* analyzeButton_;
+		Urho3D::Button* clearButton_;
+		Urho3D::SharedPtr<Urho3D::Node> highlightNode_;
+		Urho3D::CustomGeometry* highlightGeometry_;
+		unsigned selectedIssue_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,502 @@
+#include "CollisionAnalyzer.h"
+#include "CollisionShapeGeometry.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Container/Sort.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/Urho2D/CollisionBox2D.h>
+#include <Urho3D/Urho2D/CollisionChain2D.h>
+#include <Urho3D/Urho2D/CollisionCircle2D.h>
+#include <Urho3D/Urho2D/CollisionEdge2D.h>
+#include <Urho3D/Urho2D/CollisionPolygon2D.h>
+
+using namespace Urho3D;
+
+/// Box2D b2_linearSlop, contacts within it are resting contacts rather than overlaps.
+static const float LINEAR_SLOP = 0.005f;
+static const unsigned NUM_CIRCLE_SEGMENTS = 16;
+
+static inline float Orientation(const Vector2& a, const Vector2& b, const Vector2& c)
+{
+	return (b - a).CrossProduct(c - a);
+}
+
+/// Interleaved bits of the position quantized over the bounds.
+static unsigned GetMortonKey(const Vector2& position, const Rect& bounds)
+{
+	auto size = bounds.Size();
+	unsigned key = 0;
+	auto x = (unsigned)(size.x_ > 0.0f ? (position.x_ - bounds.min_.x_) / size.x_ * 65535.0f : 0.0f);
+	auto y = (unsigned)(size.y_ > 0.0f ? (position.y_ - bounds.min_.y_) / size.y_ * 65535.0f : 0.0f);
+
+	for (unsigned bit = 0; bit < 16; bit++)
+	{
+		key |= ((x >> bit) & 1) << (2 * bit);
+		key |= ((y >> bit) & 1) << (2 * bit + 1);
+	}
+
+	return key;
+}
+
+static String GetShapeName(CollisionShape2D* shape)
+{
+	if (shape == nullptr)
+	{
+		return "(removed)";
+	}
+
+	auto node = shape->GetNode();
+	auto nodeName = node->GetName().Empty() ? ToString("Node %u", node->GetID()) : node->GetName();
+	return nodeName + " > " + shape->GetTypeName();
+}
+
+namespace Geode
+{
+	CollisionAnalyzer::CollisionAnalyzer(Context* context) : Object(context)
+	{
+		numPairs_ = 0;
+		elapsedTime_ = 0.0f;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	const Vector<CollisionAnalyzer::Issue>& CollisionAnalyzer::GetIssues() const
+	{
+		return issues_;
+	}
+
+	unsigned CollisionAnalyzer::GetNumShapes() const
+	{
+		return entries_.Size();
+	}
+
+	unsigned CollisionAnalyzer::GetNumPairs() const
+	{
+		return numPairs_;
+	}
+
+	float CollisionAnalyzer::GetElapsedTime() const
+	{
+		return elapsedTime_;
+	}
+
+	String CollisionAnalyzer::GetDescription(const Issue& issue)
+	{
+		auto name = GetShapeName(issue.shape);
+
+		switch (issue.type)
+		{
+		case IssueType::OVERLAP:
+			return ToString("Overlap %.3f: ", issue.depth) + name + " / " + GetShapeName(issue.otherShape);
+		case IssueType::TOO_FEW_VERTICES:
+			return "Too few vertices: " + name;
+		case IssueType::TOO_MANY_VERTICES:
+			return ToString("More than %u vertices: ", CollisionShapeGeometry::MAX_POLYGON_VERTICES) + name;
+		case IssueType::SELF_INTERSECTING:
+			return "Self-intersecting: " + name;
+		case IssueType::NON_CONVEX:
+			return "Non-convex: " + name;
+		case IssueType::ZERO_SIZE:
+			return "Zero size: " + name;
+		}
+
+		return name;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionAnalyzer::Analyze(Node* rootNode)
+	{
+		GEODE_TRACE("CollisionAnalyzer::Analyze", "command");
+
+		PODVector<CollisionShape2D*> shapes;
+		HashMap<CollisionShape2D*, unsigned> proxies;
+		Rect bounds(Vector2(M_INFINITY, M_INFINITY), Vector2(-M_INFINITY, -M_INFINITY));
+		HiresTimer timer;
+
+		entries_.Clear();
+		issues_.Clear();
+		numPairs_ = 0;
+		rootNode->GetDerivedComponents<CollisionShape2D>(shapes, true);
+		entries_.Reserve(shapes.Size());
+
+		for (auto shape : shapes)
+		{
+			ShapeEntry entry;
+
+			if (!shape->IsEnabledEffective() || !BuildEntry(shape, entry))
+			{
+				continue;
+			}
+
+			// Invalid shapes are reported once, and kept out of the overlap test.
+			entry.solid = CheckValidity(entry) && entry.solid;
+			entries_.Push(entry);
+			bounds.Merge(entry.rect);
+		}
+
+		// Walked along a Z-order curve, consecutive queries go down the same branches while they are still cached.
+		PODVector<Pair<unsigned, unsigned>> order;
+		order.Reserve(entries_.Size());
+
+		for (unsigned i = 0; i < entries_.Size(); i++)
+		{
+			order.Push(MakePair(GetMortonKey(entries_[i].rect.Center(), bounds), i));
+		}
+
+		Sort(order.Begin(), order.End(), [](const Pair<unsigned, unsigned>& a, const Pair<unsigned, unsigned>& b) { return a.first_ < b.first_; });
+
+		for (auto& item : order)
+		{
+			auto& entry = entries_[item.second_];
+			auto proxyIt = proxies_.Find(entry.shape);
+
+			// The tree is kept between runs, only shapes which moved since are reinserted.
+			if (proxyIt != proxies_.End())
+			{
+				tree_.MoveProxy(proxyIt->second_, entry.rect);
+				tree_.SetUserData(proxyIt->second_, item.second_);
+				proxies[entry.shape] = proxyIt->second_;
+				proxies_.Erase(proxyIt);
+			}
+			else
+			{
+				proxies[entry.shape] = tree_.CreateProxy(entry.rect, item.second_);
+			}
+		}
+
+		for (auto& proxy : proxies_)
+		{
+			tree_.DestroyProxy(proxy.second_);
+		}
+
+		proxies_.Swap(proxies);
+
+		for (auto& item : order)
+		{
+			auto i = item.second_;
+			auto& entry = entries_[i];
+
+			if (!entry.solid)
+			{
+				continue;
+			}
+
+			// Each pair is tested once, from its lowest index.
+			tree_.Query(entry.rect, [&](unsigned proxy)
+			{
+				auto j = tree_.GetUserData(proxy);
+				auto& other = entries_[j];
+
+				if (j <= i || !other.solid || entry.rect.IsInside(other.rect) == OUTSIDE || !ShouldCollide(entry, other))
+				{
+					return;
+				}
+
+				numPairs_++;
+				auto depth = GetPenetration(entry, other);
+
+				if (depth > LINEAR_SLOP)
+				{
+					AddIssue(IssueType::OVERLAP, entry, &other, depth);
+				}
+			});
+		}
+
+		// Invalid shapes first, then the deepest overlaps.
+		Sort(issues_.Begin(), issues_.End(), [](const Issue& a, const Issue& b)
+		{
+			if ((a.type == IssueType::OVERLAP) != (b.type == IssueType::OVERLAP))
+			{
+				return b.type == IssueType::OVERLAP;
+			}
+
+			return a.depth > b.depth;
+		});
+
+		elapsedTime_ = timer.GetUSec(false) / 1000.0f;
+		URHO3D_LOGINFO(ToString("Analyzed %u collision shapes in %.1f ms: %u candidate pairs, %u issues (tree height %d)",
+			entries_.Size(), elapsedTime_, numPairs_, issues_.Size(), tree_.GetHeight()));
+	}
+
+	void CollisionAnalyzer::Clear()
+	{
+		tree_.Clear();
+		proxies_.Clear();
+		entries_.Clear();
+		issues_.Clear();
+		numPairs_ = 0;
+	}
+
+	bool CollisionAnalyzer::BuildEntry(CollisionShape2D* shape, ShapeEntry& dest)
+	{
+		dest.shape = shape;
+		dest.body = shape->GetNode()->GetComponent<RigidBody2D>();
+		dest.radius = 0.0f;
+		dest.closed = true;
+
+		// Chains and edges only collide by their edges, nothing can be inside them.
+		dest.solid = !shape->IsTrigger() && !shape->IsInstanceOf<CollisionChain2D>() && !shape->IsInstanceOf<CollisionEdge2D>();
+
+		if (CollisionShapeGeometry::GetWorldCircle(shape, dest.center, dest.radius))
+		{
+			dest.vertices.Clear();
+			dest.rect = Rect(dest.center - Vector2(dest.radius, dest.radius), dest.center + Vector2(dest.radius, dest.radius));
+			return true;
+		}
+
+		if (!CollisionShapeGeometry::GetWorldOutline(shape, dest.vertices, dest.closed))
+		{
+			return false;
+		}
+
+		dest.center = Vector2::ZERO;
+		dest.rect = Rect(Vector2(M_INFINITY, M_INFINITY), Vector2(-M_INFINITY, -M_INFINITY));
+
+		for (auto& vertex : dest.vertices)
+		{
+			dest.rect.Merge(vertex);
+		}
+
+		return true;
+	}
+
+	bool CollisionAnalyzer::CheckValidity(const ShapeEntry& entry)
+	{
+		auto shape = entry.shape;
+		auto& vertices = entry.vertices;
+		auto numVertices = vertices.Size();
+
+		if (shape->IsInstanceOf<CollisionCircle2D>())
+		{
+			if (entry.radius <= LINEAR_SLOP)
+			{
+				AddIssue(IssueType::ZERO_SIZE, entry, nullptr, 0.0f);
+				return false;
+			}
+
+			return true;
+		}
+
+		if (numVertices < (entry.closed ? 3U : 2U))
+		{
+			AddIssue(IssueType::TOO_FEW_VERTICES, entry, nullptr, 0.0f);
+			return false;
+		}
+
+		// Box2D drops vertices closer than the slop, chains and edges assert on them.
+		for (unsigned i = 0; i < (entry.closed ? numVertices : numVertices - 1); i++)
+		{
+			if ((vertices[(i + 1) % numVertices] - vertices[i]).Length() <= LINEAR_SLOP)
+			{
+				AddIssue(IssueType::ZERO_SIZE, entry, nullptr, 0.0f);
+				return false;
+			}
+		}
+
+		if (!shape->IsInstanceOf<CollisionPolygon2D>() && !shape->IsInstanceOf<CollisionBox2D>())
+		{
+			return true;
+		}
+
+		if (numVertices > CollisionShapeGeometry::MAX_POLYGON_VERTICES)
+		{
+			AddIssue(IssueType::TOO_MANY_VERTICES, entry, nullptr, 0.0f);
+			return false;
+		}
+
+		// Non-adjacent edges crossing each other.
+		for (unsigned i = 0; i < numVertices; i++)
+		{
+			auto& a = vertices[i];
+			auto& b = vertices[(i + 1) % numVertices];
+
+			for (unsigned j = i + 2; j < numVertices; j++)
+			{
+				if (i == 0 && j == numVertices - 1)
+				{
+					continue;
+				}
+
+				auto& c = vertices[j];
+				auto& d = vertices[(j + 1) % numVertices];
+
+				if (Orientation(a, b, c) * Orientation(a, b, d) < 0.0f && Orientation(c, d, a) * Orientation(c, d, b) < 0.0f)
+				{
+					AddIssue(IssueType::SELF_INTERSECTING, entry, nullptr, 0.0f);
+					return false;
+				}
+			}
+		}
+
+		auto area = 0.0f;
+
+		for (unsigned i = 0; i < numVertices; i++)
+		{
+			area += vertices[i].CrossProduct(vertices[(i + 1) % numVertices]);
+		}
+
+		if (Abs(area) * 0.5f <= LINEAR_SLOP * LINEAR_SLOP)
+		{
+			AddIssue(IssueType::ZERO_SIZE, entry, nullptr, 0.0f);
+			return false;
+		}
+
+		// Every turn goes the same way as the whole outline, Box2D would silently use the convex hull otherwise.
+		for (unsigned i = 0; i < numVertices; i++)
+		{
+			auto turn = Orientation(vertices[i], vertices[(i + 1) % numVertices], vertices[(i + 2) % numVertices]);
+
+			if (turn * (area > 0.0f ? 1.0f : -1.0f) < -LINEAR_SLOP * LINEAR_SLOP)
+			{
+				AddIssue(IssueType::NON_CONVEX, entry, nullptr, 0.0f);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool CollisionAnalyzer::ShouldCollide(const ShapeEntry& a, const ShapeEntry& b)
+	{
+		// Fixtures of one body never touch each other.
+		if (a.body != nullptr && a.body == b.body)
+		{
+			return false;
+		}
+
+		// Same filtering as b2ContactFilter::ShouldCollide, a shared group overrides the category and mask bits.
+		auto groupIndex = a.shape->GetGroupIndex();
+
+		if (groupIndex != 0 && groupIndex == b.shape->GetGroupIndex())
+		{
+			return groupIndex > 0;
+		}
+
+		return (a.shape->GetMaskBits() & b.shape->GetCategoryBits()) != 0 && (a.shape->GetCategoryBits() & b.shape->GetMaskBits()) != 0;
+	}
+
+	float CollisionAnalyzer::GetPenetration(const ShapeEntry& a, const ShapeEntry& b) const
+	{
+		if (a.vertices.Empty() && b.vertices.Empty())
+		{
+			return a.radius + b.radius - (a.center - b.center).Length();
+		}
+
+		// Separating axis test, the smallest overlap over all axes is the penetration depth.
+		PODVector<Vector2> axes;
+
+		for (auto entry : { &a, &b })
+		{
+			auto& vertices = entry->vertices;
+
+			for (unsigned i = 0; i < vertices.Size(); i++)
+			{
+				auto edge = vertices[(i + 1) % vertices.Size()] - vertices[i];
+				axes.Push(Vector2(-edge.y_, edge.x_).Normalized());
+			}
+		}
+
+		// A circle against a polygon also separates along its closest vertex.
+		for (auto circle : { &a, &b })
+		{
+			auto& polygon = circle == &a ? b : a;
+
+			if (!circle->vertices.Empty())
+			{
+				continue;
+			}
+
+			auto closest = polygon.vertices[0];
+
+			for (auto& vertex : polygon.vertices)
+			{
+				if ((vertex - circle->center).LengthSquared() < (closest - circle->center).LengthSquared())
+				{
+					closest = vertex;
+				}
+			}
+
+			if (closest != circle->center)
+			{
+				axes.Push((circle->center - closest).Normalized());
+			}
+		}
+
+		auto depth = M_INFINITY;
+
+		for (auto& axis : axes)
+		{
+			float minA, maxA, minB, maxB;
+
+			for (auto entry : { &a, &b })
+			{
+				auto& minValue = entry == &a ? minA : minB;
+				auto& maxValue = entry == &a ? maxA : maxB;
+				minValue = entry->center.DotProduct(axis) - entry->radius;
+				maxValue = entry->center.DotProduct(axis) + entry->radius;
+
+				if (!entry->vertices.Empty())
+				{
+					minValue = M_INFINITY;
+					maxValue = -M_INFINITY;
+
+					for (auto& vertex : entry->vertices)
+					{
+						minValue = Min(minValue, vertex.DotProduct(axis));
+						maxValue = Max(maxValue, vertex.DotProduct(axis));
+					}
+				}
+			}
+
+			depth = Min(depth, Min(maxA, maxB) - Max(minA, minB));
+
+			if (depth <= 0.0f)
+			{
+				break;
+			}
+		}
+
+		return depth;
+	}
+
+	void CollisionAnalyzer::GetOutline(const ShapeEntry& entry, PODVector<Vector2>& dest) const
+	{
+		dest = entry.vertices;
+
+		if (dest.Empty())
+		{
+			for (unsigned i = 0; i < NUM_CIRCLE_SEGMENTS; i++)
+			{
+				auto angle = 360.0f * i / NUM_CIRCLE_SEGMENTS;
+				dest.Push(entry.center + Vector2(Cos(angle), Sin(angle)) * entry.radius);
+			}
+		}
+	}
+
+	void CollisionAnalyzer::AddIssue(IssueType type, const ShapeEntry& entry, const ShapeEntry* other, float depth)
+	{
+		Issue issue;
+		issue.type = type;
+		issue.shape = entry.shape;
+		issue.closed = entry.closed;
+		issue.rect = entry.rect;
+		issue.depth = depth;
+		GetOutline(entry, issue.outline);
+
+		if (other != nullptr)
+		{
+			issue.otherShape = other->shape;
+			issue.rect.Merge(other->rect);
+			GetOutline(*other, issue.otherOutline);
+		}
+
+		issues_.Push(issue);
+	}
+}
\ No newline at end of file
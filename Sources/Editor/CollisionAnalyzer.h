@@ -0,0 +1,87 @@
+/**
+ * @file    CollisionAnalyzer.h
+ * @ingroup Editor
+ * @brief   Overlapping and invalid collision shapes of a scene, paired through a dynamic AABB tree.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "DynamicAabbTree.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Scene/Node.h>
+#include <Urho3D/Urho2D/CollisionShape2D.h>
+#include <Urho3D/Urho2D/RigidBody2D.h>
+
+namespace Geode
+{
+	class CollisionAnalyzer : public Urho3D::Object
+	{
+		URHO3D_OBJECT(CollisionAnalyzer, Urho3D::Object)
+
+	public:
+		enum class IssueType { OVERLAP, TOO_FEW_VERTICES, TOO_MANY_VERTICES, SELF_INTERSECTING, NON_CONVEX, ZERO_SIZE };
+
+		struct Issue {
+			IssueType type;
+			Urho3D::WeakPtr<Urho3D::CollisionShape2D> shape;
+			Urho3D::WeakPtr<Urho3D::CollisionShape2D> otherShape;
+			Urho3D::PODVector<Urho3D::Vector2> outline;
+			Urho3D::PODVector<Urho3D::Vector2> otherOutline;
+			bool closed;
+			Urho3D::Rect rect;
+			float depth;
+		};
+
+		struct ShapeEntry {
+			Urho3D::CollisionShape2D* shape;
+			Urho3D::RigidBody2D* body;
+			Urho3D::PODVector<Urho3D::Vector2> vertices;
+			Urho3D::Vector2 center;
+			float radius;
+			bool closed;
+			bool solid;
+			Urho3D::Rect rect;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<CollisionAnalyzer>;
+
+	public:
+		/// Constructors.
+		explicit CollisionAnalyzer(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		const Urho3D::Vector<Issue>& GetIssues() const;
+		unsigned GetNumShapes() const;
+		unsigned GetNumPairs() const;
+		float GetElapsedTime() const;
+		static Urho3D::String GetDescription(const Issue& issue);
+
+		/// Other methods.
+		void Analyze(Urho3D::Node* rootNode);
+		void Clear();
+
+	private:
+		/// Other methods.
+		bool BuildEntry(Urho3D::CollisionShape2D* shape, ShapeEntry& dest);
+		bool CheckValidity(const ShapeEntry& entry);
+		static bool ShouldCollide(const ShapeEntry& a, const ShapeEntry& b);
+		float GetPenetration(const ShapeEntry& a, const ShapeEntry& b) const;
+		void GetOutline(const ShapeEntry& entry, Urho3D::PODVector<Urho3D::Vector2>& dest) const;
+		void AddIssue(IssueType type, const ShapeEntry& entry, const ShapeEntry* other, float depth);
+
+	private:
+		Geode::DynamicAabbTree tree_;
+		Urho3D::HashMap<Urho3D::CollisionShape2D*, unsigned> proxies_;
+		Urho3D::Vector<ShapeEntry> entries_;
+		Urho3D::Vector<Issue> issues_;
+		unsigned numPairs_;
+		float elapsedTime_;
+	};
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "CollisionBox2DTool.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/Scene/SceneEvents.h>
 
@@ -27,12 +28,11 @@ namespace Geode
 
 		SetSelectedCollisionBox2D(editorScene_->GetSelectedObjectAs<CollisionBox2D>());
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(CollisionBox2DTool, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(CollisionBox2DTool, HandleSelectedObjectChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_SIZECHANGED, URHO3D_HANDLER(CollisionBox2DTool, HandleAnchorBoxSizeChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CENTERCHANGED, URHO3D_HANDLER(CollisionBox2DTool, HandleAnchorBoxCenterChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CONFIRM_CHANGED, URHO3D_HANDLER(CollisionBox2DTool, HandleAnchorBoxConfirmChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CANCELED, URHO3D_HANDLER(CollisionBox2DTool, HandleAnchorBoxCanceled));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(CollisionBox2DTool, HandleSelectedObjectChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_SIZECHANGED, GEODE_HANDLER(CollisionBox2DTool, HandleAnchorBoxSizeChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CENTERCHANGED, GEODE_HANDLER(CollisionBox2DTool, HandleAnchorBoxCenterChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CONFIRM_CHANGED, GEODE_HANDLER(CollisionBox2DTool, HandleAnchorBoxConfirmChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CANCELED, GEODE_HANDLER(CollisionBox2DTool, HandleAnchorBoxCanceled));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -53,7 +53,7 @@ namespace Geode
 	///  EVENT METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void CollisionBox2DTool::HandleSceneUpdate(StringHash, VariantMap&)
+	void CollisionBox2DTool::HandleEditorUpdate(StringHash, VariantMap&)
 	{
 		if (!IsActive())
 		{
@@ -0,0 +1,368 @@
+#include "CollisionChain2DTool.h"
+#include "../Gui/EventProfiler.h"
+
+#include <Urho3D/UI/UI.h>
+#include <Urho3D/Scene/SceneEvents.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Input/InputEvents.h>
+
+using namespace Urho3D;
+
+static const String INSERT_CURSOR_SHAPE = "Cross";
+static const int VERTEX_Z_INDEX = -3;
+static const float VERTEX_HALF_SIZE = 0.04f;
+static const Color VERTEX_COLOR = Color(0, 0, 1);
+static const float SELECTED_VERTEX_HALF_SIZE = 0.06f;
+static const Color SELECTED_VERTEX_COLOR = Color(1, 0, 0);
+static const Color EDGE_COLOR = Color(1, 1, 0);
+static const float VERTEX_PICK_RADIUS = 0.07f;
+static const float EDGE_INSERT_DISTANCE = 0.1f;
+
+namespace Geode
+{
+	CollisionChain2DTool::CollisionChain2DTool(Context* context, CommandHistory::Ptr commandHistory, SceneView::Ptr sceneView) : ITool(context)
+	{
+		commandHistory_ = commandHistory;
+		sceneView_ = sceneView;
+		editorScene_ = sceneView->GetEditorScene();
+		cursor_ = GetSubsystem<UI>()->GetCursor();
+		selectedCollisionChain2D_ = nullptr;
+		mode_ = Mode::INSERTION;
+		selectedVertexIndex_ = -1;
+		dragging_ = false;
+		vertexGrid_ = MakeShared<VertexGrid>(context_);
+		simplificationPreview_ = MakeShared<SimplificationPreview>(context_, sceneView);
+		renderVersion_ = M_MAX_UNSIGNED;
+		renderSelectedVertexIndex_ = -1;
+
+		pathNode_ = MakeShared<Node>(context_);
+		pathGeometry_ = pathNode_->CreateComponent<CustomGeometry>();
+		pathGeometry_->SetEnabled(false);
+
+		SetSelectedCollisionChain2D(editorScene_->GetSelectedObjectAs<CollisionChain2D>());
+
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(CollisionChain2DTool, HandleSelectedObjectChanged));
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionChain2DTool::SetMode(Mode mode)
+	{
+		if (mode != mode_)
+		{
+			mode_ = mode;
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	UIElement* CollisionChain2DTool::PopulateToolBar(ToolBar* toolBar)
+	{
+		return nullptr;
+	}
+
+	bool CollisionChain2DTool::IsActive()
+	{
+		return IsEnabled() && selectedCollisionChain2D_ != nullptr;
+	}
+
+	void CollisionChain2DTool::Deactivate()
+	{
+		dragging_ = false;
+		pathGeometry_->SetEnabled(false);
+		simplificationPreview_->Hide();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionChain2DTool::HandleEditorUpdate(StringHash, VariantMap&)
+	{
+		UpdateCursor();
+		UpdateComponent();
+		UpdateVertexGrid();
+		UpdateRender();
+	}
+
+	void CollisionChain2DTool::HandleSelectedObjectChanged(StringHash, VariantMap&)
+	{
+		SetSelectedCollisionChain2D(editorScene_->GetSelectedObjectAs<CollisionChain2D>());
+	}
+
+	void CollisionChain2DTool::HandleKeyDown(StringHash, VariantMap& eventData)
+	{
+		if (!IsActive())
+		{
+			return;
+		}
+
+		auto key = eventData[KeyDown::P_KEY].GetInt();
+
+		if (key == KEY_I)
+		{
+			mode_ = Mode::INSERTION;
+		}
+		else if (key == KEY_E)
+		{
+			mode_ = Mode::EDITION;
+		}
+		else if (key == KEY_DELETE && mode_ == Mode::EDITION && selectedVertexIndex_ != -1)
+		{
+			CommandInvoker(MakeShared<DeleteVertexCollisionChain2DCommand>(editorScene_, selectedVertexIndex_), commandHistory_).Exec();
+			selectedVertexIndex_ = -1;
+		}
+		else if (key == KEY_S)
+		{
+			simplificationPreview_->SetEnabled(!simplificationPreview_->IsEnabled());
+		}
+		else if (key == KEY_PAGEUP && simplificationPreview_->IsEnabled())
+		{
+			simplificationPreview_->SetMaxDeviation(simplificationPreview_->GetMaxDeviation() * 2.0f);
+		}
+		else if (key == KEY_PAGEDOWN && simplificationPreview_->IsEnabled())
+		{
+			simplificationPreview_->SetMaxDeviation(simplificationPreview_->GetMaxDeviation() * 0.5f);
+		}
+		else if (key == KEY_RETURN && simplificationPreview_->IsEnabled())
+		{
+			CommandInvoker(MakeShared<SimplifyCollisionShapeCommand>(editorScene_, simplificationPreview_->GetMaxDeviation()), commandHistory_).Exec();
+			selectedVertexIndex_ = -1;
+		}
+	}
+
+	void CollisionChain2DTool::HandleSceneViewDragBegin(StringHash, VariantMap& eventData)
+	{
+		if (!IsActive())
+		{
+			return;
+		}
+
+		auto mousePosition = GetLocalMousePosition(eventData[SceneViewDragBegin::P_X].GetFloat(), eventData[SceneViewDragBegin::P_Y].GetFloat());
+
+		// The selection or an undo may have changed the vertices since the last update.
+		UpdateVertexGrid();
+
+		if (mode_ == Mode::EDITION)
+		{
+			selectedVertexIndex_ = GetVertexIndexAt(mousePosition);
+
+			if (selectedVertexIndex_ != -1)
+			{
+				beginEditingVertexPosition_ = vertexGrid_->GetVertices()[selectedVertexIndex_];
+				beginEditingMousePosition_ = mousePosition;
+
+				// Setting vertices recreates the whole chain fixture, so the drag only moves the grid copy.
+				dragging_ = true;
+			}
+		}
+		else if (mode_ == Mode::INSERTION)
+		{
+			auto edgeIndex = vertexGrid_->GetNearestEdge(mousePosition, EDGE_INSERT_DISTANCE);
+
+			// Clicking next to an edge splits it, anywhere else the chain is extended.
+			auto index = edgeIndex != -1 ? (unsigned)edgeIndex + 1 : vertexGrid_->GetNumVertices();
+			CommandInvoker(MakeShared<AddVertexCollisionChain2DCommand>(editorScene_, mousePosition, index), commandHistory_).Exec();
+		}
+	}
+
+	void CollisionChain2DTool::HandleSceneViewDragMove(StringHash, VariantMap& eventData)
+	{
+		if (!IsActive() || !dragging_)
+		{
+			return;
+		}
+
+		auto mousePosition = GetLocalMousePosition(eventData[SceneViewDragMove::P_X].GetFloat(), eventData[SceneViewDragMove::P_Y].GetFloat());
+		vertexGrid_->SetVertex(selectedVertexIndex_, beginEditingVertexPosition_ + mousePosition - beginEditingMousePosition_);
+	}
+
+	void CollisionChain2DTool::HandleSceneViewDragEnd(StringHash, VariantMap& eventData)
+	{
+		if (!IsActive() || !dragging_)
+		{
+			return;
+		}
+
+		dragging_ = false;
+
+		auto mousePosition = GetLocalMousePosition(eventData[SceneViewDragEnd::P_X].GetFloat(), eventData[SceneViewDragEnd::P_Y].GetFloat());
+		auto mouseDelta = mousePosition - beginEditingMousePosition_;
+
+		// The fixture is rebuilt once, by the command.
+		if (mode_ == Mode::EDITION && mouseDelta != Vector2::ZERO)
+		{
+			auto vertex = beginEditingVertexPosition_ + mouseDelta;
+			CommandInvoker(MakeShared<MoveVertexCollisionChain2DCommand>(editorScene_, selectedVertexIndex_, beginEditingVertexPosition_, vertex), commandHistory_).Exec();
+		}
+	}
+
+	void CollisionChain2DTool::HandleSceneViewDragCancel(StringHash, VariantMap&)
+	{
+		if (!IsActive() || !dragging_)
+		{
+			return;
+		}
+
+		// The component was never touched, the grid gets its vertices back on the next update.
+		dragging_ = false;
+		selectedVertexIndex_ = -1;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  UPDATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionChain2DTool::UpdateCursor()
+	{
+		if (!IsActive())
+		{
+			return;
+		}
+
+		if (sceneView_->IsMouseInsideViewport() && mode_ == Mode::INSERTION)
+		{
+			cursor_->SetShape(INSERT_CURSOR_SHAPE);
+		}
+	}
+
+	void CollisionChain2DTool::UpdateComponent()
+	{
+		if (!IsActive())
+		{
+			return;
+		}
+
+		// Box2D needs two vertices for a chain, three for a loop.
+		auto minVertexCount = selectedCollisionChain2D_->GetLoop() ? 3U : 2U;
+		selectedCollisionChain2D_->SetEnabled(selectedCollisionChain2D_->GetVertexCount() >= minVertexCount);
+	}
+
+	void CollisionChain2DTool::UpdateVertexGrid()
+	{
+		// While dragging the grid holds the previewed vertices, the component is only written at drag end.
+		if (IsActive() && !dragging_)
+		{
+			vertexGrid_->SetVertices(selectedCollisionChain2D_->GetVertices(), selectedCollisionChain2D_->GetLoop());
+		}
+	}
+
+	void CollisionChain2DTool::UpdateRender()
+	{
+		if (!IsActive())
+		{
+			pathGeometry_->SetEnabled(false);
+			simplificationPreview_->Hide();
+			return;
+		}
+
+		if (!pathGeometry_->IsEnabled() && editorScene_->GetComponent<Octree>() != nullptr)
+		{
+			pathGeometry_->SetEnabled(true);
+			editorScene_->GetComponent<Octree>()->AddManualDrawable(pathGeometry_);
+			renderVersion_ = M_MAX_UNSIGNED;
+		}
+
+		pathNode_->SetTransform(selectedCollisionChain2D_->GetNode()->GetTransform());
+		simplificationPreview_->Update(selectedCollisionChain2D_->GetNode(), vertexGrid_->GetVertices(), vertexGrid_->IsClosed(), vertexGrid_->GetVersion());
+
+		// Long chains have thousands of vertices, geometry is only rebuilt when they or the highlighted one change.
+		if (renderVersion_ == vertexGrid_->GetVersion() && renderSelectedVertexIndex_ == selectedVertexIndex_)
+		{
+			return;
+		}
+
+		renderVersion_ = vertexGrid_->GetVersion();
+		renderSelectedVertexIndex_ = selectedVertexIndex_;
+
+		auto& vertices = vertexGrid_->GetVertices();
+		auto numEdges = vertexGrid_->GetNumEdges();
+		auto material = GetSubsystem<ResourceCache>()->GetResource<Material>("Materials/VColUnlit.xml");
+
+		pathGeometry_->Clear();
+		pathGeometry_->SetNumGeometries(2);
+
+		// One batch for all the vertex markers, one for all the edges.
+		pathGeometry_->BeginGeometry(0, PrimitiveType::TRIANGLE_LIST);
+
+		for (int i = 0; i < (int)vertices.Size(); i++)
+		{
+			auto center = Vector3(vertices[i], VERTEX_Z_INDEX);
+			auto color = (i == selectedVertexIndex_) ? SELECTED_VERTEX_COLOR : VERTEX_COLOR;
+			auto halfSize = (i == selectedVertexIndex_) ? SELECTED_VERTEX_HALF_SIZE : VERTEX_HALF_SIZE;
+			Vector3 corners[] = {
+				center + Vector3(-halfSize, -halfSize),
+				center + Vector3(-halfSize, halfSize),
+				center + Vector3(halfSize, halfSize),
+				center + Vector3(halfSize, -halfSize)
+			};
+			unsigned indices[] = { 0, 1, 2, 0, 2, 3 };
+
+			for (auto index : indices)
+			{
+				pathGeometry_->DefineVertex(corners[index]);
+				pathGeometry_->DefineColor(color);
+			}
+		}
+
+		pathGeometry_->SetMaterial(0, material);
+		pathGeometry_->BeginGeometry(1, PrimitiveType::LINE_LIST);
+
+		for (unsigned i = 0; i < numEdges; i++)
+		{
+			pathGeometry_->DefineVertex(Vector3(vertices[i], VERTEX_Z_INDEX));
+			pathGeometry_->DefineColor(EDGE_COLOR);
+			pathGeometry_->DefineVertex(Vector3(vertices[(i + 1) % vertices.Size()], VERTEX_Z_INDEX));
+			pathGeometry_->DefineColor(EDGE_COLOR);
+		}
+
+		pathGeometry_->SetMaterial(1, material);
+		pathGeometry_->Commit();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void CollisionChain2DTool::SetSelectedCollisionChain2D(CollisionChain2D* selectedCollisionChain2D)
+	{
+		if (selectedCollisionChain2D == nullptr)
+		{
+			SetEnabled(false);
+		}
+		else
+		{
+			SetEnabled(true);
+		}
+
+		selectedCollisionChain2D_ = selectedCollisionChain2D;
+		selectedVertexIndex_ = -1;
+		dragging_ = false;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	int CollisionChain2DTool::GetVertexIndexAt(Vector2 position)
+	{
+		if (!IsActive())
+		{
+			return -1;
+		}
+
+		return vertexGrid_->GetNearestVertex(position, VERTEX_PICK_RADIUS);
+	}
+
+	Vector2 CollisionChain2DTool::GetLocalMousePosition(float x, float y) const
+	{
+		auto transform = selectedCollisionChain2D_->GetNode()->GetTransform();
+		auto mousePosition = transform.Inverse() * Vector3(x, y);
+		return Vector2(mousePosition.x_, mousePosition.y_);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+ * @file    CollisionChain2DTool.h
+ * @ingroup Editor
+ * @brief   Tool used to create/edit CollisionChain2D component.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "ITool.h"
+#include "Commands.h"
+#include "SceneView.h"
+#include "SceneViewEvents.h"
+#include "EditorScene.h"
+#include "EditorSceneEvents.h"
+#include "VertexGrid.h"
+#include "SimplificationPreview.h"
+#include "../Gui/Toolbar.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Urho2D/CollisionChain2D.h>
+
+namespace Geode
+{
+	class CollisionChain2DTool : public Geode::ITool
+	{
+		URHO3D_OBJECT(CollisionChain2DTool, Geode::ITool)
+
+		enum Mode {
+			INSERTION,
+			EDITION
+		};
+
+	public:
+		/// Constructors.
+		explicit CollisionChain2DTool(Urho3D::Context* context, Geode::CommandHistory::Ptr commandHistory, Geode::SceneView::Ptr sceneView);
+
+		/// Accessors & Mutators.
+		void SetMode(Mode mode);
+
+		/// Other methods.
+		Urho3D::UIElement* PopulateToolBar(Geode::ToolBar* toolBar) override;
+		bool IsActive() override;
+		void Deactivate() override;
+
+	private:
+		/// Event handlers.
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleKeyDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+
+		/// Update methods.
+		void UpdateCursor();
+		void UpdateComponent();
+		void UpdateVertexGrid();
+		void UpdateRender();
+
+		/// Accessors & Mutators.
+		void SetSelectedCollisionChain2D(Urho3D::CollisionChain2D* selectedCollisionChain2D);
+
+		/// Other methods.
+		int GetVertexIndexAt(Urho3D::Vector2 position);
+		Urho3D::Vector2 GetLocalMousePosition(float x, float y) const;
+
+	private:
+		Geode::CommandHistory::Ptr commandHistory_;
+		Geode::SceneView::Ptr sceneView_;
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::Cursor* cursor_;
+		Urho3D::CollisionChain2D* selectedCollisionChain2D_;
+		Urho3D::SharedPtr<Urho3D::Node> pathNode_;
+		Urho3D::CustomGeometry* pathGeometry_;
+		Mode mode_;
+		Urho3D::Vector2 beginEditingVertexPosition_;
+		Urho3D::Vector2 beginEditingMousePosition_;
+		int selectedVertexIndex_;
+		bool dragging_;
+		Geode::VertexGrid::Ptr vertexGrid_;
+		Geode::SimplificationPreview::Ptr simplificationPreview_;
+		unsigned renderVersion_;
+		int renderSelectedVertexIndex_;
+	};
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "CollisionCircle2DTool.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/Scene/SceneEvents.h>
 
@@ -22,13 +23,12 @@ namespace Geode
 
 		SetSelectedCollisionCircle2D(editorScene_->GetSelectedObjectAs<CollisionCircle2D>());
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(CollisionCircle2DTool, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(CollisionCircle2DTool, HandleSelectedObjectChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_SIZECHANGED, URHO3D_HANDLER(CollisionCircle2DTool, HandleAnchorBoxSizeChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CENTERCHANGED, URHO3D_HANDLER(CollisionCircle2DTool, HandleAnchorBoxCenterChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CONFIRM_SIZECHANGED, URHO3D_HANDLER(CollisionCircle2DTool, HandleAnchorBoxConfirmSizeChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CONFIRM_CENTERCHANGED, URHO3D_HANDLER(CollisionCircle2DTool, HandleAnchorBoxConfirmCenterChanged));
-		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CANCELED, URHO3D_HANDLER(CollisionCircle2DTool, HandleAnchorBoxCanceled));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(CollisionCircle2DTool, HandleSelectedObjectChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_SIZECHANGED, GEODE_HANDLER(CollisionCircle2DTool, HandleAnchorBoxSizeChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CENTERCHANGED, GEODE_HANDLER(CollisionCircle2DTool, HandleAnchorBoxCenterChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CONFIRM_SIZECHANGED, GEODE_HANDLER(CollisionCircle2DTool, HandleAnchorBoxConfirmSizeChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CONFIRM_CENTERCHANGED, GEODE_HANDLER(CollisionCircle2DTool, HandleAnchorBoxConfirmCenterChanged));
+		SubscribeToEvent(anchorBox_, E_ANCHORBOX_CANCELED, GEODE_HANDLER(CollisionCircle2DTool, HandleAnchorBoxCanceled));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -49,7 +49,7 @@ namespace Geode
 	///  EVENT METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void CollisionCircle2DTool::HandleSceneUpdate(StringHash, VariantMap&)
+	void CollisionCircle2DTool::HandleEditorUpdate(StringHash, VariantMap&)
 	{
 		if (!IsActive())
 		{
@@ -39,7 +39,7 @@ namespace Geode
 
 	private:
 		/// Event handlers.
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
 		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleAnchorBoxSizeChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleAnchorBoxCenterChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
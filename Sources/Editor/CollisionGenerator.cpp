@@ -0,0 +1,206 @@
+#include "CollisionGenerator.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/Urho2D/StaticSprite2D.h>
+
+using namespace Urho3D;
+
+namespace Geode
+{
+	CollisionGenerator::CollisionGenerator(Context* context) : Object(context)
+	{
+		numSprites_ = 0;
+		numNodes_ = 0;
+		numPieces_ = 0;
+		elapsedTime_ = 0.0f;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	unsigned CollisionGenerator::GetNumSprites() const
+	{
+		return numSprites_;
+	}
+
+	unsigned CollisionGenerator::GetNumNodes() const
+	{
+		return numNodes_;
+	}
+
+	unsigned CollisionGenerator::GetNumPieces() const
+	{
+		return numPieces_;
+	}
+
+	float CollisionGenerator::GetElapsedTime() const
+	{
+		return elapsedTime_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	ICommand::Ptr CollisionGenerator::Generate(EditorScene::Ptr editorScene)
+	{
+		GEODE_TRACE("CollisionGenerator::Generate", "command");
+
+		auto queue = GetSubsystem<WorkQueue>();
+		auto command = MakeShared<CompoundCommand>();
+		PODVector<StaticSprite2D*> staticSprites;
+		HashMap<Sprite2D*, unsigned> taskIndices;
+		HiresTimer timer;
+
+		// The editor shares its outline cache, so sprites traced before are only decomposed.
+		spriteOutline_ = GetSubsystem<SpriteOutline>();
+
+		if (spriteOutline_ == nullptr)
+		{
+			spriteOutline_ = MakeShared<SpriteOutline>(context_);
+		}
+
+		tasks_.Clear();
+		editorScene->GetComponents<StaticSprite2D>(staticSprites, true);
+
+		// Resources are only touched here, workers get the image data and the sprite geometry.
+		for (auto staticSprite : staticSprites)
+		{
+			auto sprite = staticSprite->GetSprite();
+
+			if (sprite == nullptr || taskIndices.Contains(sprite))
+			{
+				continue;
+			}
+
+			SpriteTask task;
+			task.sprite = sprite;
+			task.hotSpot = sprite->GetHotSpot();
+
+			if (spriteOutline_->HasOutlines(sprite))
+			{
+				spriteOutline_->GetOutlines(sprite, task.outlines);
+			}
+			else
+			{
+				task.image = SpriteOutline::GetSpriteImage(sprite);
+				task.rect = SpriteOutline::GetSpriteRect(sprite, task.image);
+			}
+
+			taskIndices[sprite] = tasks_.Size();
+			tasks_.Push(task);
+		}
+
+		// One decomposition per thread, the main thread works too while waiting.
+		auto numThreads = queue != nullptr ? queue->GetNumThreads() + 1 : 1;
+
+		while (decompositions_.Size() < numThreads)
+		{
+			decompositions_.Push(MakeShared<ConvexDecomposition>(context_));
+		}
+
+		for (auto& task : tasks_)
+		{
+			if (queue == nullptr)
+			{
+				WorkItem item;
+				item.aux_ = this;
+				item.start_ = &task;
+				ProcessTask(&item, 0);
+				continue;
+			}
+
+			auto item = queue->GetFreeItem();
+			item->priority_ = M_MAX_UNSIGNED;
+			item->workFunction_ = ProcessTask;
+			item->aux_ = this;
+			item->start_ = &task;
+			item->sendEvent_ = false;
+			queue->AddWorkItem(item);
+		}
+
+		if (queue != nullptr)
+		{
+			queue->Complete(M_MAX_UNSIGNED);
+		}
+
+		numSprites_ = tasks_.Size();
+		numNodes_ = 0;
+		numPieces_ = 0;
+
+		for (auto& task : tasks_)
+		{
+			if (task.image != nullptr)
+			{
+				spriteOutline_->SetOutlines(task.sprite, task.rect.Size(), task.traced);
+			}
+		}
+
+		HashSet<Node*> nodes;
+
+		for (auto staticSprite : staticSprites)
+		{
+			auto taskIt = taskIndices.Find(staticSprite->GetSprite());
+			auto node = staticSprite->GetNode();
+
+			// A node is shaped after its first sprite.
+			if (taskIt == taskIndices.End() || nodes.Contains(node) || tasks_[taskIt->second_].pieces.Empty())
+			{
+				continue;
+			}
+
+			auto pieces = tasks_[taskIt->second_].pieces;
+
+			// Flipped sprites are mirrored around the node origin.
+			for (auto& piece : pieces)
+			{
+				for (auto& vertex : piece)
+				{
+					vertex.x_ = staticSprite->GetFlipX() ? -vertex.x_ : vertex.x_;
+					vertex.y_ = staticSprite->GetFlipY() ? -vertex.y_ : vertex.y_;
+				}
+			}
+
+			nodes.Insert(node);
+			command->Add(MakeShared<ReplaceCollisionPolygon2DCommand>(editorScene, node, pieces));
+			numNodes_++;
+			numPieces_ += pieces.Size();
+		}
+
+		tasks_.Clear();
+		elapsedTime_ = timer.GetUSec(false) / 1000.0f;
+
+		URHO3D_LOGINFO(ToString("Generated %u collision pieces for %u nodes from %u sprites in %.1f ms on %u threads (%.0f sprites/s)",
+			numPieces_, numNodes_, numSprites_, elapsedTime_, numThreads, elapsedTime_ > 0.0f ? numSprites_ * 1000.0f / elapsedTime_ : 0.0f));
+
+		return command;
+	}
+
+	void CollisionGenerator::ProcessTask(const WorkItem* item, unsigned threadIndex)
+	{
+		auto generator = static_cast<CollisionGenerator*>(item->aux_);
+		auto task = static_cast<SpriteTask*>(item->start_);
+		auto decomposition = generator->decompositions_[threadIndex].Get();
+
+		// Only pure functions of the image and the task run here, no object is shared between threads.
+		if (task->image != nullptr)
+		{
+			SpriteOutline::Trace(task->image, task->rect, generator->spriteOutline_->GetAlphaThreshold(), generator->spriteOutline_->GetTolerance(), task->traced);
+			SpriteOutline::ToSpriteSpace(task->traced, task->rect.Size(), task->hotSpot, task->outlines);
+		}
+
+		for (auto& outline : task->outlines)
+		{
+			Vector<PODVector<Vector2>> pieces;
+
+			if (decomposition->Decompose(outline, pieces))
+			{
+				task->pieces.Push(pieces);
+			}
+		}
+	}
+}
\ No newline at end of file
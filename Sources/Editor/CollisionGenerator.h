@@ -0,0 +1,65 @@
+/**
+ * @file    CollisionGenerator.h
+ * @ingroup Editor
+ * @brief   Collision shapes generated for every StaticSprite2D of a scene, sprites processed on worker threads.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "Commands.h"
+#include "ConvexDecomposition.h"
+#include "SpriteOutline.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/WorkQueue.h>
+
+namespace Geode
+{
+	class CollisionGenerator : public Urho3D::Object
+	{
+		URHO3D_OBJECT(CollisionGenerator, Urho3D::Object)
+
+		struct SpriteTask {
+			Urho3D::Sprite2D* sprite;
+			Urho3D::SharedPtr<Urho3D::Image> image;
+			Urho3D::IntRect rect;
+			Urho3D::Vector2 hotSpot;
+			Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>> traced;
+			Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>> outlines;
+			Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>> pieces;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<CollisionGenerator>;
+
+	public:
+		/// Constructors.
+		explicit CollisionGenerator(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		unsigned GetNumSprites() const;
+		unsigned GetNumNodes() const;
+		unsigned GetNumPieces() const;
+		float GetElapsedTime() const;
+
+		/// Other methods.
+		Geode::ICommand::Ptr Generate(Geode::EditorScene::Ptr editorScene);
+
+	private:
+		/// Other methods.
+		static void ProcessTask(const Urho3D::WorkItem* item, unsigned threadIndex);
+
+	private:
+		Geode::SpriteOutline::Ptr spriteOutline_;
+		Urho3D::Vector<SpriteTask> tasks_;
+		Urho3D::Vector<Geode::ConvexDecomposition::Ptr> decompositions_;
+		unsigned numSprites_;
+		unsigned numNodes_;
+		unsigned numPieces_;
+		float elapsedTime_;
+	};
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "CollisionPolygon2DTool.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/Scene/SceneEvents.h>
@@ -15,6 +16,9 @@ static const float VERTEX_CIRCLE_RADIUS = 0.05f;
 static const Color VERTEX_CIRCLE_COLOR = Color(0, 0, 1);
 static const float SELECTED_VERTEX_CIRCLE_RADIUS = 0.07f;
 static const Color SELECTED_VERTEX_CIRCLE_COLOR = Color(1, 0, 0);
+static const Color PREVIEW_EDGE_COLOR = Color(1, 1, 0);
+static const float EDGE_INSERT_DISTANCE = 0.1f;
+static const Color DECOMPOSITION_EDGE_COLOR = Color(0, 1, 1);
 
 namespace Geode
 {
@@ -27,6 +31,13 @@ namespace Geode
 		selectedCollisionPolygon2D_ = nullptr;
 		mode_ = Mode::INSERTION;
 		selectedVertexIndex_ = -1;
+		dragging_ = false;
+		vertexGrid_ = MakeShared<VertexGrid>(context_);
+		simplificationPreview_ = MakeShared<SimplificationPreview>(context_, sceneView);
+		renderVersion_ = M_MAX_UNSIGNED;
+		renderSelectedVertexIndex_ = -1;
+		renderDragging_ = false;
+		decomposition_ = MakeShared<ConvexDecomposition>(context_);
 
 		pathNode_ = MakeShared<Node>(context_);
 		pathGeometry_ = pathNode_->CreateComponent<CustomGeometry>();
@@ -34,13 +45,7 @@ namespace Geode
 
 		SetSelectedCollisionPolygon2D(editorScene_->GetSelectedObjectAs<CollisionPolygon2D>());
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(CollisionPolygon2DTool, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(CollisionPolygon2DTool, HandleSelectedObjectChanged));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, URHO3D_HANDLER(CollisionPolygon2DTool, HandleSceneViewDragBegin));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, URHO3D_HANDLER(CollisionPolygon2DTool, HandleSceneViewDragMove));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, URHO3D_HANDLER(CollisionPolygon2DTool, HandleSceneViewDragEnd));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, URHO3D_HANDLER(CollisionPolygon2DTool, HandleSceneViewDragCancel));
-		SubscribeToEvent(E_KEYDOWN, URHO3D_HANDLER(CollisionPolygon2DTool, HandleKeyDown));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(CollisionPolygon2DTool, HandleSelectedObjectChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -69,14 +74,22 @@ namespace Geode
 		return IsEnabled() && selectedCollisionPolygon2D_ != nullptr;
 	}
 
+	void CollisionPolygon2DTool::Deactivate()
+	{
+		dragging_ = false;
+		pathGeometry_->SetEnabled(false);
+		simplificationPreview_->Hide();
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
-	void CollisionPolygon2DTool::HandleSceneUpdate(StringHash, VariantMap&)
+	void CollisionPolygon2DTool::HandleEditorUpdate(StringHash, VariantMap&)
 	{
 		UpdateCursor();
 		UpdateComponent();
+		UpdateVertexGrid();
 		UpdateRender();
 	}
 
@@ -107,6 +120,28 @@ namespace Geode
 			CommandInvoker(MakeShared<DeleteVertexCollisionPolygon2DCommand>(editorScene_, selectedVertexIndex_), commandHistory_).Exec();
 			selectedVertexIndex_ = -1;
 		}
+		else if (key == KEY_D)
+		{
+			// Replaces the selected component, the tool is deactivated by the selection change.
+			CommandInvoker(MakeShared<DecomposeCollisionPolygon2DCommand>(editorScene_), commandHistory_).Exec();
+		}
+		else if (key == KEY_S)
+		{
+			simplificationPreview_->SetEnabled(!simplificationPreview_->IsEnabled());
+		}
+		else if (key == KEY_PAGEUP && simplificationPreview_->IsEnabled())
+		{
+			simplificationPreview_->SetMaxDeviation(simplificationPreview_->GetMaxDeviation() * 2.0f);
+		}
+		else if (key == KEY_PAGEDOWN && simplificationPreview_->IsEnabled())
+		{
+			simplificationPreview_->SetMaxDeviation(simplificationPreview_->GetMaxDeviation() * 0.5f);
+		}
+		else if (key == KEY_RETURN && simplificationPreview_->IsEnabled())
+		{
+			CommandInvoker(MakeShared<SimplifyCollisionShapeCommand>(editorScene_, simplificationPreview_->GetMaxDeviation()), commandHistory_).Exec();
+			selectedVertexIndex_ = -1;
+		}
 	}
 
 	void CollisionPolygon2DTool::HandleSceneViewDragBegin(StringHash, VariantMap& eventData)
@@ -119,6 +154,9 @@ namespace Geode
 		auto transform = selectedCollisionPolygon2D_->GetNode()->GetTransform();
 		auto mousePosition = transform.Inverse() * Vector3(eventData[SceneViewDragBegin::P_X].GetFloat(), eventData[SceneViewDragBegin::P_Y].GetFloat());
 
+		// The selection or an undo may have changed the vertices since the last update.
+		UpdateVertexGrid();
+
 		if (mode_ == Mode::EDITION)
 		{
 			auto vertexIndex = GetVertexIndexAt(Vector2(mousePosition.x_, mousePosition.y_));
@@ -128,6 +166,9 @@ namespace Geode
 				selectedVertexIndex_ = vertexIndex;
 				beginEditingVertexPosition_ = selectedCollisionPolygon2D_->GetVertex(vertexIndex);
 				beginEditingMousePosition_ = Vector2(mousePosition.x_, mousePosition.y_);
+
+				// Setting vertices recreates the fixture, so the drag only moves the grid copy.
+				dragging_ = true;
 			}
 			else
 			{
@@ -137,13 +178,17 @@ namespace Geode
 		else if (mode_ == Mode::INSERTION)
 		{
 			auto vertex = Vector2(mousePosition.x_, mousePosition.y_);
-			CommandInvoker(MakeShared<AddVertexCollisionPolygon2DCommand>(editorScene_, vertex), commandHistory_).Exec();
+			auto edgeIndex = vertexGrid_->GetNumVertices() >= 3 ? vertexGrid_->GetNearestEdge(vertex, EDGE_INSERT_DISTANCE) : -1;
+
+			// Clicking next to an edge splits it, anywhere else the vertex goes last.
+			auto index = edgeIndex != -1 ? (unsigned)edgeIndex + 1 : vertexGrid_->GetNumVertices();
+			CommandInvoker(MakeShared<AddVertexCollisionPolygon2DCommand>(editorScene_, vertex, index), commandHistory_).Exec();
 		}
 	}
 
 	void CollisionPolygon2DTool::HandleSceneViewDragMove(StringHash, VariantMap& eventData)
 	{
-		if (!IsActive() || selectedVertexIndex_ == -1)
+		if (!IsActive() || !dragging_)
 		{
 			return;
 		}
@@ -151,24 +196,24 @@ namespace Geode
 		auto transform = selectedCollisionPolygon2D_->GetNode()->GetTransform();
 		auto mousePosition = transform.Inverse() * Vector3(eventData[SceneViewDragMove::P_X].GetFloat(), eventData[SceneViewDragMove::P_Y].GetFloat());
 		auto mouseDelta = Vector2(mousePosition.x_, mousePosition.y_) - beginEditingMousePosition_;
-		auto vertex = beginEditingVertexPosition_ + mouseDelta;
 
-		auto vertices = selectedCollisionPolygon2D_->GetVertices();
-		vertices[selectedVertexIndex_] = vertex;
-		selectedCollisionPolygon2D_->SetVertices(vertices);
+		vertexGrid_->SetVertex(selectedVertexIndex_, beginEditingVertexPosition_ + mouseDelta);
 	}
 
 	void CollisionPolygon2DTool::HandleSceneViewDragEnd(StringHash, VariantMap& eventData)
 	{
-		if (!IsActive() || selectedVertexIndex_ == -1)
+		if (!IsActive() || !dragging_)
 		{
 			return;
 		}
 
+		dragging_ = false;
+
 		auto transform = selectedCollisionPolygon2D_->GetNode()->GetTransform();
 		auto mousePosition = transform.Inverse() * Vector3(eventData[SceneViewDragEnd::P_X].GetFloat(), eventData[SceneViewDragEnd::P_Y].GetFloat());
 		auto mouseDelta = Vector2(mousePosition.x_, mousePosition.y_) - beginEditingMousePosition_;
 
+		// The fixture is rebuilt once, by the command.
 		if (mode_ == Mode::EDITION && mouseDelta != Vector2::ZERO)
 		{
 			auto vertex = beginEditingVertexPosition_ + mouseDelta;
@@ -178,15 +223,13 @@ namespace Geode
 
 	void CollisionPolygon2DTool::HandleSceneViewDragCancel(StringHash, VariantMap&)
 	{
-		if (!IsActive() || selectedVertexIndex_ == -1)
+		if (!IsActive() || !dragging_)
 		{
 			return;
 		}
 
-		auto vertices = selectedCollisionPolygon2D_->GetVertices();
-		vertices[selectedVertexIndex_] = beginEditingVertexPosition_;
-		selectedCollisionPolygon2D_->SetVertices(vertices);
-
+		// The component was never touched, the grid gets its vertices back on the next update.
+		dragging_ = false;
 		selectedVertexIndex_ = -1;
 	}
 
@@ -224,11 +267,21 @@ namespace Geode
 		}
 	}
 
+	void CollisionPolygon2DTool::UpdateVertexGrid()
+	{
+		// While dragging the grid holds the previewed vertices, the component is only written at drag end.
+		if (IsActive() && !dragging_)
+		{
+			vertexGrid_->SetVertices(selectedCollisionPolygon2D_->GetVertices(), true);
+		}
+	}
+
 	void CollisionPolygon2DTool::UpdateRender()
 	{
 		if (!IsActive())
 		{
 			pathGeometry_->SetEnabled(false);
+			simplificationPreview_->Hide();
 			return;
 		}
 
@@ -236,40 +289,90 @@ namespace Geode
 		{
 			pathGeometry_->SetEnabled(true);
 			editorScene_->GetComponent<Octree>()->AddManualDrawable(pathGeometry_);
+			renderVersion_ = M_MAX_UNSIGNED;
+		}
+
+		auto transform = selectedCollisionPolygon2D_->GetNode()->GetTransform();
+		pathNode_->SetTransform(transform);
+		simplificationPreview_->Update(selectedCollisionPolygon2D_->GetNode(), vertexGrid_->GetVertices(), true, vertexGrid_->GetVersion());
+
+		// Geometry is only rebuilt when the vertices or the highlighted one change.
+		if (renderVersion_ == vertexGrid_->GetVersion() && renderSelectedVertexIndex_ == selectedVertexIndex_ && renderDragging_ == dragging_)
+		{
+			return;
 		}
 
-		auto vertices = selectedCollisionPolygon2D_->GetVertices();
+		renderVersion_ = vertexGrid_->GetVersion();
+		renderSelectedVertexIndex_ = selectedVertexIndex_;
+		renderDragging_ = dragging_;
+
+		auto& vertices = vertexGrid_->GetVertices();
+		auto material = GetSubsystem<ResourceCache>()->GetResource<Material>("Materials/VColUnlit.xml");
+
+		// Concave or oversized outlines show the pieces they would be split in, live while editing.
+		if (vertices.Size() >= 3 && (vertices.Size() > decomposition_->GetMaxVertices() || !ConvexDecomposition::IsConvex(vertices)))
+		{
+			decomposition_->Decompose(vertices, decompositionPieces_);
+		}
+		else
+		{
+			decompositionPieces_.Clear();
+		}
 
 		pathGeometry_->Clear();
-		pathGeometry_->SetNumGeometries(vertices.Size());
+		pathGeometry_->SetNumGeometries(2);
 
-		for (int i = 0; i < vertices.Size(); i++)
+		// All the vertex circles go in a single batch.
+		pathGeometry_->BeginGeometry(0, PrimitiveType::TRIANGLE_LIST);
+
+		for (int i = 0; i < (int)vertices.Size(); i++)
 		{
 			auto vertex = Vector3(vertices[i], VERTEX_CIRCLE_Z_INDEX);
 			auto color = (i == selectedVertexIndex_) ? SELECTED_VERTEX_CIRCLE_COLOR : VERTEX_CIRCLE_COLOR;
 			auto radius = (i == selectedVertexIndex_) ? SELECTED_VERTEX_CIRCLE_RADIUS : VERTEX_CIRCLE_RADIUS;
 
-			pathGeometry_->BeginGeometry(i, PrimitiveType::TRIANGLE_STRIP);
-			pathGeometry_->DefineVertex(vertex);
-
-			for (int j = VERTEX_CIRCLE_STEPS; j >= 0; j--)
+			for (unsigned j = 0; j < VERTEX_CIRCLE_STEPS; j++)
 			{
 				auto angle = ((float)j / (float)VERTEX_CIRCLE_STEPS) * 360.0f;
-				auto p = Vector3(radius * Cos<float>(angle), radius * Sin<float>(angle));
+				auto nextAngle = ((float)(j + 1) / (float)VERTEX_CIRCLE_STEPS) * 360.0f;
 
-				pathGeometry_->DefineVertex(vertex + p);
-				pathGeometry_->DefineColor(color);
 				pathGeometry_->DefineVertex(vertex);
 				pathGeometry_->DefineColor(color);
+				pathGeometry_->DefineVertex(vertex + Vector3(radius * Cos<float>(nextAngle), radius * Sin<float>(nextAngle)));
+				pathGeometry_->DefineColor(color);
+				pathGeometry_->DefineVertex(vertex + Vector3(radius * Cos<float>(angle), radius * Sin<float>(angle)));
+				pathGeometry_->DefineColor(color);
 			}
+		}
 
-			pathGeometry_->SetMaterial(i, GetSubsystem<ResourceCache>()->GetResource<Material>("Materials/VColUnlit.xml"));
+		pathGeometry_->SetMaterial(0, material);
+		pathGeometry_->BeginGeometry(1, PrimitiveType::LINE_LIST);
+
+		for (auto& piece : decompositionPieces_)
+		{
+			for (unsigned i = 0; i < piece.Size(); i++)
+			{
+				pathGeometry_->DefineVertex(Vector3(piece[i], VERTEX_CIRCLE_Z_INDEX));
+				pathGeometry_->DefineColor(DECOMPOSITION_EDGE_COLOR);
+				pathGeometry_->DefineVertex(Vector3(piece[(i + 1) % piece.Size()], VERTEX_CIRCLE_Z_INDEX));
+				pathGeometry_->DefineColor(DECOMPOSITION_EDGE_COLOR);
+			}
 		}
 
-		pathGeometry_->Commit();
+		// Physics debug draws the committed shape, the outline shows where it goes.
+		if (dragging_)
+		{
+			for (unsigned i = 0; i < vertices.Size(); i++)
+			{
+				pathGeometry_->DefineVertex(Vector3(vertices[i], VERTEX_CIRCLE_Z_INDEX));
+				pathGeometry_->DefineColor(PREVIEW_EDGE_COLOR);
+				pathGeometry_->DefineVertex(Vector3(vertices[(i + 1) % vertices.Size()], VERTEX_CIRCLE_Z_INDEX));
+				pathGeometry_->DefineColor(PREVIEW_EDGE_COLOR);
+			}
+		}
 
-		auto transform = selectedCollisionPolygon2D_->GetNode()->GetTransform();
-		pathNode_->SetTransform(transform);
+		pathGeometry_->SetMaterial(1, material);
+		pathGeometry_->Commit();
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -288,6 +391,7 @@ namespace Geode
 		}
 
 		selectedCollisionPolygon2D_ = selectedCollisionPolygon2D;
+		dragging_ = false;
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -301,19 +405,14 @@ namespace Geode
 			return -1;
 		}
 
-		auto vertices = selectedCollisionPolygon2D_->GetVertices();
+		auto index = vertexGrid_->GetNearestVertex(position, SELECTED_VERTEX_CIRCLE_RADIUS);
 
-		for (unsigned int i = 0; i < vertices.Size(); i++)
+		// Only the selected vertex is drawn, and picked, with the larger radius.
+		if (index != -1 && index != selectedVertexIndex_ && (vertexGrid_->GetVertices()[index] - position).Length() > VERTEX_CIRCLE_RADIUS)
 		{
-			auto delta = vertices[i] - position;
-			auto radius = (i == selectedVertexIndex_) ? SELECTED_VERTEX_CIRCLE_RADIUS : VERTEX_CIRCLE_RADIUS;
-
-			if (sqrt((delta.x_ * delta.x_) + (delta.y_ * delta.y_)) <= radius)
-			{
-				return i;
-			}
+			return -1;
 		}
 
-		return -1;
+		return index;
 	}
 }
\ No newline at end of file
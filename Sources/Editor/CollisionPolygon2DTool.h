@@ -18,6 +18,9 @@
 #include "EditorScene.h"
 #include "EditorSceneEvents.h"
 #include "AnchorBox.h"
+#include "VertexGrid.h"
+#include "SimplificationPreview.h"
+#include "ConvexDecomposition.h"
 #include "../Gui/Toolbar.h"
 
 #include <Urho3D/Core/Context.h>
@@ -51,20 +54,22 @@ namespace Geode
 		/// Other methods.
 		Urho3D::UIElement* PopulateToolBar(Geode::ToolBar* toolBar) override;
 		bool IsActive() override;
+		void Deactivate() override;
 
 	private:
 		/// Event handlers.
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
 		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleKeyDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleKeyDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
 
 		/// Update methods.
 		void UpdateCursor();
 		void UpdateComponent();
+		void UpdateVertexGrid();
 		void UpdateRender();
 
 		/// Accessors & Mutators.
@@ -85,5 +90,13 @@ namespace Geode
 		Urho3D::Vector2 beginEditingVertexPosition_;
 		Urho3D::Vector2 beginEditingMousePosition_;
 		int selectedVertexIndex_;
+		bool dragging_;
+		Geode::VertexGrid::Ptr vertexGrid_;
+		Geode::SimplificationPreview::Ptr simplificationPreview_;
+		unsigned renderVersion_;
+		int renderSelectedVertexIndex_;
+		bool renderDragging_;
+		Geode::ConvexDecomposition::Ptr decomposition_;
+		Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>> decompositionPieces_;
 	};
 }
\ No newline at end of file
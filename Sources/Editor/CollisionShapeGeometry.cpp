@@ -0,0 +1,100 @@
+#include "CollisionShapeGeometry.h"
+
+#include <Urho3D/Scene/Node.h>
+#include <Urho3D/Urho2D/CollisionBox2D.h>
+#include <Urho3D/Urho2D/CollisionChain2D.h>
+#include <Urho3D/Urho2D/CollisionCircle2D.h>
+#include <Urho3D/Urho2D/CollisionEdge2D.h>
+#include <Urho3D/Urho2D/CollisionPolygon2D.h>
+
+using namespace Urho3D;
+
+static inline Vector2 Rotate(const Vector2& point, float angle)
+{
+	auto c = Cos(angle);
+	auto s = Sin(angle);
+	return Vector2(point.x_ * c - point.y_ * s, point.x_ * s + point.y_ * c);
+}
+
+namespace Geode
+{
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool CollisionShapeGeometry::GetWorldOutline(CollisionShape2D* shape, PODVector<Vector2>& dest, bool& closed)
+	{
+		auto node = shape->GetNode();
+		auto scale = node->GetWorldScale2D();
+		dest.Clear();
+		closed = true;
+
+		// Same fixture geometry as Box2D gets: shape scaled in body space, then placed by the body.
+		if (shape->IsInstanceOf<CollisionBox2D>())
+		{
+			auto box = static_cast<CollisionBox2D*>(shape);
+			auto halfSize = box->GetSize() * scale * 0.5f;
+			Vector2 offsets[] = { Vector2(-halfSize.x_, -halfSize.y_), Vector2(halfSize.x_, -halfSize.y_), Vector2(halfSize.x_, halfSize.y_), Vector2(-halfSize.x_, halfSize.y_) };
+
+			for (auto& offset : offsets)
+			{
+				dest.Push(box->GetCenter() * scale + Rotate(offset, box->GetAngle()));
+			}
+		}
+		else if (shape->IsInstanceOf<CollisionPolygon2D>())
+		{
+			for (auto& vertex : static_cast<CollisionPolygon2D*>(shape)->GetVertices())
+			{
+				dest.Push(vertex * scale);
+			}
+		}
+		else if (shape->IsInstanceOf<CollisionChain2D>())
+		{
+			auto chain = static_cast<CollisionChain2D*>(shape);
+			closed = chain->GetLoop();
+
+			for (auto& vertex : chain->GetVertices())
+			{
+				dest.Push(vertex * scale);
+			}
+		}
+		else if (shape->IsInstanceOf<CollisionEdge2D>())
+		{
+			auto edge = static_cast<CollisionEdge2D*>(shape);
+			closed = false;
+			dest.Push(edge->GetVertex1() * scale);
+			dest.Push(edge->GetVertex2() * scale);
+		}
+		else
+		{
+			return false;
+		}
+
+		auto position = node->GetWorldPosition2D();
+		auto rotation = node->GetWorldRotation2D();
+
+		for (auto& vertex : dest)
+		{
+			vertex = position + Rotate(vertex, rotation);
+		}
+
+		return true;
+	}
+
+	bool CollisionShapeGeometry::GetWorldCircle(CollisionShape2D* shape, Vector2& center, float& radius)
+	{
+		if (!shape->IsInstanceOf<CollisionCircle2D>())
+		{
+			return false;
+		}
+
+		auto node = shape->GetNode();
+		auto scale = node->GetWorldScale2D();
+		auto circle = static_cast<CollisionCircle2D*>(shape);
+
+		// Box2D circles only take the x scale.
+		center = node->GetWorldPosition2D() + Rotate(circle->GetCenter() * scale, node->GetWorldRotation2D());
+		radius = Abs(circle->GetRadius() * scale.x_);
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+/**
+ * @file    CollisionShapeGeometry.h
+ * @ingroup Editor
+ * @brief   World space geometry of 2D collision shapes, as Box2D builds their fixtures.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Container/Vector.h>
+#include <Urho3D/Math/Vector2.h>
+#include <Urho3D/Urho2D/CollisionShape2D.h>
+
+namespace Geode
+{
+	class CollisionShapeGeometry
+	{
+	public:
+		/// Box2D b2_maxPolygonVertices.
+		static const unsigned MAX_POLYGON_VERTICES = 8;
+
+	public:
+		/// Other methods.
+		static bool GetWorldOutline(Urho3D::CollisionShape2D* shape, Urho3D::PODVector<Urho3D::Vector2>& dest, bool& closed);
+		static bool GetWorldCircle(Urho3D::CollisionShape2D* shape, Urho3D::Vector2& center, float& radius);
+	};
+}
\ No newline at end of file
@@ -1,7 +1,71 @@
 #include "Commands.h"
+#include "ColliderMerger.h"
+#include "ConvexDecomposition.h"
+#include "PolylineSimplifier.h"
+#include "SpriteOutline.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/Urho2D/CollisionEdge2D.h>
 
 using namespace Urho3D;
 
+/// Replace count vertices from start, chain commands only keep the edited span and the fixture is rebuilt once.
+static void ReplaceVertexRange(CollisionChain2D* component, unsigned start, unsigned count, const PODVector<Vector2>& vertices)
+{
+	auto& previousVertices = component->GetVertices();
+	PODVector<Vector2> newVertices;
+	newVertices.Reserve(previousVertices.Size() - count + vertices.Size());
+
+	for (unsigned i = 0; i < start; i++)
+	{
+		newVertices.Push(previousVertices[i]);
+	}
+
+	newVertices.Push(vertices);
+
+	for (unsigned i = start + count; i < previousVertices.Size(); i++)
+	{
+		newVertices.Push(previousVertices[i]);
+	}
+
+	component->SetVertices(newVertices);
+}
+
+/// Map a shape point from a node into another, scale included as Box2D applies it to the fixture geometry.
+static Vector2 TransformPoint(const Vector2& point, Node* sourceNode, Node* targetNode)
+{
+	auto position = targetNode->GetWorldTransform().Inverse() * (sourceNode->GetWorldTransform() * Vector3(point, 0.0f));
+	return Vector2(position.x_, position.y_);
+}
+
+/// Generated shapes behave like the one they replace.
+static void CopyShapeProperties(CollisionShape2D* source, CollisionShape2D* dest)
+{
+	dest->SetEnabled(source->IsEnabled());
+	dest->SetTrigger(source->IsTrigger());
+	dest->SetCategoryBits(source->GetCategoryBits());
+	dest->SetMaskBits(source->GetMaskBits());
+	dest->SetGroupIndex(source->GetGroupIndex());
+	dest->SetDensity(source->GetDensity());
+	dest->SetFriction(source->GetFriction());
+	dest->SetRestitution(source->GetRestitution());
+}
+
+/// Broadphase proxies of a shape, a chain has one per edge.
+static unsigned GetNumProxies(CollisionShape2D* shape)
+{
+	if (!shape->IsInstanceOf<CollisionChain2D>())
+	{
+		return 1;
+	}
+
+	auto chain = static_cast<CollisionChain2D*>(shape);
+	auto numVertices = chain->GetVertexCount();
+	return chain->GetLoop() ? numVertices : Max(numVertices, 1U) - 1;
+}
+
 namespace Geode
 {
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +142,8 @@ namespace Geode
 
 	void CommandInvoker::Exec()
 	{
+		GEODE_TRACE("CommandInvoker::Exec", "command");
+
 		if (command_->Exec())
 		{
 			commandHistory_->Push(command_);
@@ -94,6 +160,8 @@ namespace Geode
 
 	bool UndoCommand::Exec()
 	{
+		GEODE_TRACE("UndoCommand::Exec", "command");
+
 		auto lastCommand = commandHistory_->Pop();
 
 		if (lastCommand != nullptr)
@@ -104,6 +172,51 @@ namespace Geode
 		return false;
 	}
 
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  COMPOUND COMMAND
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	CompoundCommand::CompoundCommand()
+	{
+	}
+
+	void CompoundCommand::Add(ICommand::Ptr command)
+	{
+		commands_.Push(command);
+	}
+
+	unsigned CompoundCommand::GetNumCommands() const
+	{
+		return commands_.Size();
+	}
+
+	bool CompoundCommand::Exec()
+	{
+		GEODE_TRACE("CompoundCommand::Exec", "command");
+
+		executedCommands_.Clear();
+
+		// Commands with nothing to do are left out, so undo only reverts what was applied.
+		for (auto& command : commands_)
+		{
+			if (command->Exec())
+			{
+				executedCommands_.Push(command);
+			}
+		}
+
+		return !executedCommands_.Empty();
+	}
+
+	void CompoundCommand::Undo()
+	{
+		for (int i = (int)executedCommands_.Size() - 1; i >= 0; i--)
+		{
+			executedCommands_[i]->Undo();
+		}
+
+		executedCommands_.Clear();
+	}
+
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	///  UNSELECT COMMAND
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -210,101 +323,74 @@ namespace Geode
 	}
 
 	///////////////////////////////////////////////////////////////////////////////////////////////////
-	///  MOVE NODE COMMAND
+	///  TRANSFORM NODES COMMAND
 	///////////////////////////////////////////////////////////////////////////////////////////////////
-	MoveNodeCommand::MoveNodeCommand(EditorScene::Ptr editorScene, Vector2 previousPosition, Vector2 position)
+	TransformNodesCommand::TransformNodesCommand(EditorScene::Ptr editorScene, const PODVector<Node*>& nodes, const Vector<NodeTransform2D>& previousTransforms, const Vector<NodeTransform2D>& transforms)
 	{
 		editorScene_ = editorScene;
-		previousPosition_ = previousPosition;
-		position_ = position;
-		movedNode_ = nullptr;
+		nodes_ = nodes;
+		previousTransforms_ = previousTransforms;
+		transforms_ = transforms;
 	}
 
-	bool MoveNodeCommand::Exec()
+	bool TransformNodesCommand::Exec()
 	{
-		auto selectedNode = editorScene_->GetSelectedNode();
-
-		if (selectedNode == nullptr)
+		if (nodes_.Empty() || nodes_.Size() != transforms_.Size() || nodes_.Size() != previousTransforms_.Size())
 		{
 			return false;
 		}
 
-		selectedNode->SetWorldPosition2D(position_);
-		movedNode_ = selectedNode;
+		Apply(transforms_);
 		return true;
 	}
 
-	void MoveNodeCommand::Undo()
+	void TransformNodesCommand::Undo()
 	{
-		if (movedNode_ != nullptr)
-		{
-			movedNode_->SetWorldPosition2D(previousPosition_);
-		}
+		Apply(previousTransforms_);
 	}
 
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	///  SCALE NODE COMMAND
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	ScaleNodeCommand::ScaleNodeCommand(EditorScene::Ptr editorScene, Vector2 previousScale, Vector2 scale)
+	NodeTransform2D TransformNodesCommand::GetWorldTransform(Node* node)
 	{
-		editorScene_ = editorScene;
-		previousScale_ = previousScale;
-		scale_ = scale;
-		scaledNode_ = nullptr;
+		NodeTransform2D transform;
+		transform.position = node->GetWorldPosition2D();
+		transform.rotation = node->GetWorldRotation2D();
+		transform.scale = node->GetWorldScale2D();
+		return transform;
 	}
 
-	bool ScaleNodeCommand::Exec()
+	void TransformNodesCommand::SetWorldTransform(Node* node, const NodeTransform2D& transform)
 	{
-		auto selectedNode = editorScene_->GetSelectedNode();
-
-		if (selectedNode == nullptr)
-		{
-			return false;
-		}
-
-		selectedNode->SetWorldScale2D(scale_);
-		scaledNode_ = selectedNode;
-		return true;
+		node->SetWorldPosition2D(transform.position);
+		node->SetWorldRotation2D(transform.rotation);
+		node->SetWorldScale2D(transform.scale);
 	}
 
-	void ScaleNodeCommand::Undo()
+	void TransformNodesCommand::GetSelectedWorldTransforms(EditorScene* editorScene, PODVector<Node*>& nodes, Vector<NodeTransform2D>& transforms)
 	{
-		if (scaledNode_ != nullptr)
+		// Descendants of selected nodes follow their ancestor, only top-most nodes are transformed.
+		nodes = editorScene->GetSelectedNodes(true);
+		transforms.Clear();
+
+		for (auto node : nodes)
 		{
-			scaledNode_->SetWorldScale2D(previousScale_);
+			transforms.Push(GetWorldTransform(node));
 		}
 	}
 
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	///  ROTATE NODE COMMAND
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	RotateNodeCommand::RotateNodeCommand(EditorScene::Ptr editorScene, float previousRotation, float rotation)
-	{
-		editorScene_ = editorScene;
-		previousRotation_ = previousRotation;
-		rotation_ = rotation;
-		rotatedNode_ = nullptr;
-	}
-
-	bool RotateNodeCommand::Exec()
+	void TransformNodesCommand::SetWorldTransforms(const PODVector<Node*>& nodes, const Vector<NodeTransform2D>& transforms)
 	{
-		auto selectedNode = editorScene_->GetSelectedNode();
-
-		if (selectedNode == nullptr)
+		for (unsigned i = 0; i < nodes.Size(); i++)
 		{
-			return false;
+			SetWorldTransform(nodes[i], transforms[i]);
 		}
-
-		selectedNode->SetWorldRotation2D(rotation_);
-		rotatedNode_ = selectedNode;
-		return true;
 	}
 
-	void RotateNodeCommand::Undo()
+	void TransformNodesCommand::Apply(const Vector<NodeTransform2D>& transforms)
 	{
-		if (rotatedNode_ != nullptr)
+		for (unsigned i = 0; i < nodes_.Size(); i++)
 		{
-			rotatedNode_->SetWorldRotation2D(previousRotation_);
+			SetWorldTransform(nodes_[i], transforms[i]);
+			editorScene_->MarkDirty(nodes_[i]);
 		}
 	}
 
@@ -462,14 +548,45 @@ namespace Geode
 		}
 	}
 
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  CREATE COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	CreateCollisionChain2DCommand::CreateCollisionChain2DCommand(EditorScene::Ptr editorScene)
+	{
+		editorScene_ = editorScene;
+		createdComponent_ = nullptr;
+	}
+
+	bool CreateCollisionChain2DCommand::Exec()
+	{
+		auto selectedNode = editorScene_->GetSelectedNode();
+
+		if (selectedNode == nullptr)
+		{
+			return false;
+		}
+
+		createdComponent_ = selectedNode->CreateComponent<CollisionChain2D>();
+		return true;
+	}
+
+	void CreateCollisionChain2DCommand::Undo()
+	{
+		if (createdComponent_ != nullptr)
+		{
+			createdComponent_->Remove();
+		}
+	}
+
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	///  ADD VERTEX COLLISIONPOLYGON2D
 	///////////////////////////////////////////////////////////////////////////////////////////////////
-	AddVertexCollisionPolygon2DCommand::AddVertexCollisionPolygon2DCommand(EditorScene::Ptr editorScene, Vector2 vertex)
+	AddVertexCollisionPolygon2DCommand::AddVertexCollisionPolygon2DCommand(EditorScene::Ptr editorScene, Vector2 vertex, unsigned int index)
 	{
 		editorScene_ = editorScene;
 		component_ = nullptr;
 		vertex_ = vertex;
+		index_ = index;
 	}
 
 	bool AddVertexCollisionPolygon2DCommand::Exec()
@@ -488,10 +605,12 @@ namespace Geode
 			return false;
 		}
 
-		vertices.Push(vertex_);
+		index_ = Min(index_, vertices.Size());
+		vertices.Insert(index_, vertex_);
 		component->SetVertices(vertices);
 
 		component_ = component;
+		editorScene_->MarkDirty(component_);
 		return true;
 	}
 
@@ -500,8 +619,9 @@ namespace Geode
 		if (component_ != nullptr)
 		{
 			auto vertices = component_->GetVertices();
-			vertices.Pop();
+			vertices.Erase(index_);
 			component_->SetVertices(vertices);
+			editorScene_->MarkDirty(component_);
 		}
 	}
 
@@ -535,6 +655,7 @@ namespace Geode
 		vertices[index_] = vertex_;
 		component->SetVertices(vertices);
 		component_ = component;
+		editorScene_->MarkDirty(component_);
 		return true;
 	}
 
@@ -545,6 +666,7 @@ namespace Geode
 			auto vertices = component_->GetVertices();
 			vertices[index_] = previousVertex_;
 			component_->SetVertices(vertices);
+			editorScene_->MarkDirty(component_);
 		}
 	}
 
@@ -577,6 +699,7 @@ namespace Geode
 		vertices.Erase(index_);
 		component->SetVertices(vertices);
 		component_ = component;
+		editorScene_->MarkDirty(component_);
 		return true;
 	}
 
@@ -587,6 +710,736 @@ namespace Geode
 			auto vertices = component_->GetVertices();
 			vertices.Insert(index_, vertex_);
 			component_->SetVertices(vertices);
+			editorScene_->MarkDirty(component_);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  DECOMPOSE COLLISIONPOLYGON2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	DecomposeCollisionPolygon2DCommand::DecomposeCollisionPolygon2DCommand(EditorScene::Ptr editorScene)
+	{
+		editorScene_ = editorScene;
+		node_ = nullptr;
+		removedComponentId_ = 0;
+	}
+
+	bool DecomposeCollisionPolygon2DCommand::Exec()
+	{
+		auto component = editorScene_->GetSelectedObjectAs<CollisionPolygon2D>();
+
+		if (component == nullptr)
+		{
+			return false;
+		}
+
+		auto decomposition = MakeShared<ConvexDecomposition>(editorScene_->GetContext());
+		auto& vertices = component->GetVertices();
+		Vector<PODVector<Vector2>> pieces;
+
+		// Shapes Box2D already accepts are left alone.
+		if (vertices.Size() <= decomposition->GetMaxVertices() && ConvexDecomposition::IsConvex(vertices))
+		{
+			return false;
+		}
+
+		if (!decomposition->Decompose(vertices, pieces))
+		{
+			return false;
+		}
+
+		node_ = component->GetNode();
+
+		for (auto& piece : pieces)
+		{
+			auto createdComponent = node_->CreateComponent<CollisionPolygon2D>();
+			CopyShapeProperties(component, createdComponent);
+			createdComponent->SetVertices(piece);
+			createdComponents_.Push(createdComponent);
+		}
+
+		// Kept alive to be put back as is on undo.
+		removedComponent_ = component;
+		removedComponentId_ = component->GetID();
+		component->Remove();
+
+		editorScene_->MarkDirty(node_);
+		return true;
+	}
+
+	void DecomposeCollisionPolygon2DCommand::Undo()
+	{
+		if (removedComponent_ == nullptr)
+		{
+			return;
+		}
+
+		for (auto createdComponent : createdComponents_)
+		{
+			createdComponent->Remove();
+		}
+
+		node_->AddComponent(removedComponent_, removedComponentId_, removedComponentId_ < FIRST_LOCAL_ID ? REPLICATED : LOCAL);
+		createdComponents_.Clear();
+		removedComponent_.Reset();
+		editorScene_->MarkDirty(node_);
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  GENERATE COLLISIONPOLYGON2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	GenerateCollisionPolygon2DCommand::GenerateCollisionPolygon2DCommand(EditorScene::Ptr editorScene)
+	{
+		editorScene_ = editorScene;
+		node_ = nullptr;
+	}
+
+	bool GenerateCollisionPolygon2DCommand::Exec()
+	{
+		auto selectedNode = editorScene_->GetSelectedNode();
+		auto staticSprite = selectedNode != nullptr ? selectedNode->GetComponent<StaticSprite2D>() : nullptr;
+
+		if (staticSprite == nullptr || staticSprite->GetSprite() == nullptr)
+		{
+			return false;
+		}
+
+		// The editor shares one outline cache, tools without it trace every time.
+		SpriteOutline::Ptr spriteOutline(editorScene_->GetSubsystem<SpriteOutline>());
+		auto decomposition = MakeShared<ConvexDecomposition>(editorScene_->GetContext());
+		Vector<PODVector<Vector2>> outlines;
+		Vector<PODVector<Vector2>> pieces;
+
+		if (spriteOutline == nullptr)
+		{
+			spriteOutline = MakeShared<SpriteOutline>(editorScene_->GetContext());
+		}
+
+		if (!spriteOutline->GetOutlines(staticSprite->GetSprite(), outlines))
+		{
+			return false;
+		}
+
+		node_ = selectedNode;
+
+		for (auto& outline : outlines)
+		{
+			// Flipped sprites are mirrored around the node origin.
+			for (auto& vertex : outline)
+			{
+				vertex.x_ = staticSprite->GetFlipX() ? -vertex.x_ : vertex.x_;
+				vertex.y_ = staticSprite->GetFlipY() ? -vertex.y_ : vertex.y_;
+			}
+
+			if (!decomposition->Decompose(outline, pieces))
+			{
+				continue;
+			}
+
+			for (auto& piece : pieces)
+			{
+				auto createdComponent = node_->CreateComponent<CollisionPolygon2D>();
+				createdComponent->SetVertices(piece);
+				createdComponents_.Push(createdComponent);
+			}
+		}
+
+		if (createdComponents_.Empty())
+		{
+			return false;
+		}
+
+		editorScene_->MarkDirty(node_);
+		return true;
+	}
+
+	void GenerateCollisionPolygon2DCommand::Undo()
+	{
+		if (createdComponents_.Empty())
+		{
+			return;
+		}
+
+		for (auto createdComponent : createdComponents_)
+		{
+			createdComponent->Remove();
+		}
+
+		createdComponents_.Clear();
+		editorScene_->MarkDirty(node_);
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  REPLACE COLLISIONPOLYGON2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	ReplaceCollisionPolygon2DCommand::ReplaceCollisionPolygon2DCommand(EditorScene::Ptr editorScene, Node* node, const Vector<PODVector<Vector2>>& pieces)
+	{
+		editorScene_ = editorScene;
+		node_ = node;
+		pieces_ = pieces;
+	}
+
+	bool ReplaceCollisionPolygon2DCommand::Exec()
+	{
+		if (node_ == nullptr || pieces_.Empty())
+		{
+			return false;
+		}
+
+		PODVector<CollisionPolygon2D*> components;
+		node_->GetComponents<CollisionPolygon2D>(components);
+
+		for (auto& piece : pieces_)
+		{
+			auto createdComponent = node_->CreateComponent<CollisionPolygon2D>();
+
+			// Regenerated shapes keep the physics settings of the ones they replace.
+			if (!components.Empty())
+			{
+				CopyShapeProperties(components[0], createdComponent);
+			}
+
+			createdComponent->SetVertices(piece);
+			createdComponents_.Push(createdComponent);
+		}
+
+		for (auto component : components)
+		{
+			removedComponents_.Push(SharedPtr<CollisionPolygon2D>(component));
+			removedComponentIds_.Push(component->GetID());
+			component->Remove();
+		}
+
+		editorScene_->MarkDirty(node_);
+		return true;
+	}
+
+	void ReplaceCollisionPolygon2DCommand::Undo()
+	{
+		if (createdComponents_.Empty())
+		{
+			return;
+		}
+
+		for (auto createdComponent : createdComponents_)
+		{
+			createdComponent->Remove();
+		}
+
+		for (unsigned i = 0; i < removedComponents_.Size(); i++)
+		{
+			auto id = removedComponentIds_[i];
+			node_->AddComponent(removedComponents_[i], id, id < FIRST_LOCAL_ID ? REPLICATED : LOCAL);
+		}
+
+		createdComponents_.Clear();
+		removedComponents_.Clear();
+		removedComponentIds_.Clear();
+		editorScene_->MarkDirty(node_);
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  SIMPLIFY COLLISION SHAPE
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	SimplifyCollisionShapeCommand::SimplifyCollisionShapeCommand(EditorScene::Ptr editorScene, float maxDeviation)
+	{
+		editorScene_ = editorScene;
+		maxDeviation_ = maxDeviation;
+		polygon_ = nullptr;
+		chain_ = nullptr;
+	}
+
+	bool SimplifyCollisionShapeCommand::Exec()
+	{
+		auto polygon = editorScene_->GetSelectedObjectAs<CollisionPolygon2D>();
+		auto chain = editorScene_->GetSelectedObjectAs<CollisionChain2D>();
+		PODVector<Vector2> vertices;
+
+		if (polygon != nullptr)
+		{
+			PolylineSimplifier::Simplify(polygon->GetVertices(), true, maxDeviation_, vertices);
+
+			if (vertices.Size() < 3 || vertices.Size() == polygon->GetVertexCount())
+			{
+				return false;
+			}
+
+			previousVertices_ = polygon->GetVertices();
+			polygon->SetVertices(vertices);
+			polygon_ = polygon;
+			editorScene_->MarkDirty(polygon_);
+		}
+		else if (chain != nullptr)
+		{
+			PolylineSimplifier::Simplify(chain->GetVertices(), chain->GetLoop(), maxDeviation_, vertices);
+
+			// Box2D can't build a loop under 3 vertices nor a chain under 2, a coarse deviation would get there on a loop.
+			auto minVertexCount = chain->GetLoop() ? 3U : 2U;
+
+			if (vertices.Size() < minVertexCount || vertices.Size() == chain->GetVertexCount())
+			{
+				return false;
+			}
+
+			previousVertices_ = chain->GetVertices();
+			chain->SetVertices(vertices);
+			chain_ = chain;
+			editorScene_->MarkDirty(chain_);
+		}
+		else
+		{
+			return false;
+		}
+
+		URHO3D_LOGINFO(ToString("Simplified collision shape from %u to %u vertices, max deviation %.3f", previousVertices_.Size(), vertices.Size(), maxDeviation_));
+		return true;
+	}
+
+	void SimplifyCollisionShapeCommand::Undo()
+	{
+		if (polygon_ != nullptr)
+		{
+			polygon_->SetVertices(previousVertices_);
+			editorScene_->MarkDirty(polygon_);
+		}
+		else if (chain_ != nullptr)
+		{
+			chain_->SetVertices(previousVertices_);
+			editorScene_->MarkDirty(chain_);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  MERGE STATIC COLLIDERS
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	MergeStaticCollidersCommand::MergeStaticCollidersCommand(EditorScene::Ptr editorScene, bool useChains)
+	{
+		editorScene_ = editorScene;
+		useChains_ = useChains;
+		createdNode_ = nullptr;
+	}
+
+	bool MergeStaticCollidersCommand::Exec()
+	{
+		GEODE_TRACE("MergeStaticCollidersCommand::Exec", "command");
+
+		auto rootNode = editorScene_->GetSelectedNode() != nullptr ? editorScene_->GetSelectedNode() : editorScene_.Get();
+		PODVector<RigidBody2D*> bodies;
+		HashMap<String, PODVector<CollisionShape2D*>> groups;
+		auto numShapes = 0U;
+		auto numShapeProxies = 0U;
+
+		rootNode->GetComponents<RigidBody2D>(bodies, true);
+
+		// Only shapes which collide and feel alike can share an outline, disabled ones have no fixture to merge.
+		for (auto body : bodies)
+		{
+			PODVector<CollisionShape2D*> shapes;
+
+			if (body->GetBodyType() != BT_STATIC || !body->IsEnabledEffective())
+			{
+				continue;
+			}
+
+			body->GetNode()->GetDerivedComponents<CollisionShape2D>(shapes);
+
+			for (auto shape : shapes)
+			{
+				if (!shape->IsEnabledEffective())
+				{
+					continue;
+				}
+
+				numShapes++;
+				numShapeProxies += GetNumProxies(shape);
+
+				auto key = ToString("%d %u %u %d %g %g", shape->IsTrigger(), shape->GetCategoryBits(), shape->GetMaskBits(), shape->GetGroupIndex(), shape->GetFriction(), shape->GetRestitution());
+				groups[key].Push(shape);
+			}
+		}
+
+		ColliderMerger merger(editorScene_->GetContext());
+		merger.SetUseChains(useChains_);
+		auto numPolygons = 0U;
+		auto numChains = 0U;
+		auto numChainEdges = 0U;
+
+		for (auto& group : groups)
+		{
+			PODVector<CollisionShape2D*> shapes;
+			PODVector<Rect> rects;
+			PODVector<unsigned> mergedRects;
+			Vector<PODVector<Vector2>> polygons;
+			Vector<PODVector<Vector2>> chains;
+			Rect rect;
+
+			for (auto shape : group.second_)
+			{
+				if (ColliderMerger::GetWorldRect(shape, rect))
+				{
+					shapes.Push(shape);
+					rects.Push(rect);
+				}
+			}
+
+			merger.Merge(rects, polygons, chains, mergedRects);
+
+			if (mergedRects.Empty())
+			{
+				continue;
+			}
+
+			// Merged shapes live in world space under a single static body at the scene root.
+			if (createdNode_ == nullptr)
+			{
+				createdNode_ = editorScene_->CreateNewNode(nullptr);
+				createdNode_->SetName("MergedColliders");
+				createdNode_->CreateComponent<RigidBody2D>()->SetBodyType(BT_STATIC);
+			}
+
+			for (auto& polygon : polygons)
+			{
+				auto createdComponent = createdNode_->CreateComponent<CollisionPolygon2D>();
+				CopyShapeProperties(group.second_[0], createdComponent);
+				createdComponent->SetVertices(polygon);
+				numPolygons++;
+			}
+
+			for (auto& chain : chains)
+			{
+				auto createdComponent = createdNode_->CreateComponent<CollisionChain2D>();
+				CopyShapeProperties(group.second_[0], createdComponent);
+				createdComponent->SetLoop(true);
+				createdComponent->SetVertices(chain);
+				numChains++;
+				numChainEdges += chain.Size();
+			}
+
+			for (auto index : mergedRects)
+			{
+				auto shape = shapes[index];
+				removedComponents_.Push(SharedPtr<CollisionShape2D>(shape));
+				removedComponentNodes_.Push(shape->GetNode());
+				removedComponentIds_.Push(shape->GetID());
+				editorScene_->MarkDirty(shape->GetNode());
+				shape->Remove();
+			}
+		}
+
+		if (createdNode_ == nullptr)
+		{
+			return false;
+		}
+
+		// A chain is one fixture but each of its edges is a broadphase proxy, merged boxes had one each.
+		auto numFixtures = numShapes - removedComponents_.Size() + numPolygons + numChains;
+		auto numProxies = numShapeProxies - removedComponents_.Size() + numPolygons + numChainEdges;
+		URHO3D_LOGINFO(ToString("Merged %u static colliders into %u polygons and %u chains, fixtures %u -> %u, broadphase proxies %u -> %u", removedComponents_.Size(), numPolygons, numChains, numShapes, numFixtures, numShapeProxies, numProxies));
+
+		editorScene_->MarkDirty(createdNode_);
+		return true;
+	}
+
+	void MergeStaticCollidersCommand::Undo()
+	{
+		if (createdNode_ == nullptr)
+		{
+			return;
+		}
+
+		createdNode_->Remove();
+		createdNode_ = nullptr;
+
+		for (unsigned i = 0; i < removedComponents_.Size(); i++)
+		{
+			auto id = removedComponentIds_[i];
+			removedComponentNodes_[i]->AddComponent(removedComponents_[i], id, id < FIRST_LOCAL_ID ? REPLICATED : LOCAL);
+			editorScene_->MarkDirty(removedComponentNodes_[i]);
+		}
+
+		removedComponents_.Clear();
+		removedComponentNodes_.Clear();
+		removedComponentIds_.Clear();
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  ATTACH NODE
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	AttachNodeCommand::AttachNodeCommand(EditorScene::Ptr editorScene, SharedPtr<Node> node, Node* parentNode)
+	{
+		editorScene_ = editorScene;
+		node_ = node;
+		parentNode_ = parentNode;
+	}
+
+	bool AttachNodeCommand::Exec()
+	{
+		if (node_->GetParent() != nullptr)
+		{
+			return false;
+		}
+
+		parentNode_->AddChild(node_);
+		editorScene_->MarkDirty(node_);
+		return true;
+	}
+
+	void AttachNodeCommand::Undo()
+	{
+		// Kept alive by the command, so commands built around the node still find it on redo.
+		node_->Remove();
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  MOVE COLLISION SHAPES
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	MoveCollisionShapesCommand::MoveCollisionShapesCommand(EditorScene::Ptr editorScene, Node* sourceNode, Node* targetNode)
+	{
+		editorScene_ = editorScene;
+		sourceNode_ = sourceNode;
+		targetNode_ = targetNode;
+	}
+
+	bool MoveCollisionShapesCommand::Exec()
+	{
+		auto body = sourceNode_->GetComponent<RigidBody2D>();
+		PODVector<CollisionShape2D*> components;
+
+		if (body == nullptr || targetNode_->GetComponent<RigidBody2D>() == nullptr)
+		{
+			return false;
+		}
+
+		auto sourceScale = sourceNode_->GetWorldScale2D();
+		auto targetScale = targetNode_->GetWorldScale2D();
+
+		// Box2D multiplies fixture sizes by the node scale, a flattened target can't hold them.
+		if (targetScale.x_ == 0.0f || targetScale.y_ == 0.0f)
+		{
+			return false;
+		}
+
+		sourceNode_->GetDerivedComponents<CollisionShape2D>(components);
+
+		auto scale = sourceScale / targetScale;
+		auto angle = sourceNode_->GetWorldRotation2D() - targetNode_->GetWorldRotation2D();
+
+		// Sizes keep their world extent, centers and vertices already go through both transforms.
+		for (auto component : components)
+		{
+			CollisionShape2D* createdComponent = nullptr;
+
+			if (component->IsInstanceOf<CollisionBox2D>())
+			{
+				auto box = static_cast<CollisionBox2D*>(component);
+				auto createdBox = targetNode_->CreateComponent<CollisionBox2D>();
+				createdBox->SetSize(Vector2(Abs(box->GetSize().x_ * scale.x_), Abs(box->GetSize().y_ * scale.y_)));
+				createdBox->SetCenter(TransformPoint(box->GetCenter(), sourceNode_, targetNode_));
+				createdBox->SetAngle(box->GetAngle() + angle);
+				createdComponent = createdBox;
+			}
+			else if (component->IsInstanceOf<CollisionCircle2D>())
+			{
+				auto circle = static_cast<CollisionCircle2D*>(component);
+				auto createdCircle = targetNode_->CreateComponent<CollisionCircle2D>();
+				createdCircle->SetRadius(Abs(circle->GetRadius() * scale.x_));
+				createdCircle->SetCenter(TransformPoint(circle->GetCenter(), sourceNode_, targetNode_));
+				createdComponent = createdCircle;
+			}
+			else if (component->IsInstanceOf<CollisionPolygon2D>() || component->IsInstanceOf<CollisionChain2D>())
+			{
+				auto isPolygon = component->IsInstanceOf<CollisionPolygon2D>();
+				auto& vertices = isPolygon ? static_cast<CollisionPolygon2D*>(component)->GetVertices() : static_cast<CollisionChain2D*>(component)->GetVertices();
+				PODVector<Vector2> createdVertices;
+
+				for (auto& vertex : vertices)
+				{
+					createdVertices.Push(TransformPoint(vertex, sourceNode_, targetNode_));
+				}
+
+				if (isPolygon)
+				{
+					auto createdPolygon = targetNode_->CreateComponent<CollisionPolygon2D>();
+					createdPolygon->SetVertices(createdVertices);
+					createdComponent = createdPolygon;
+				}
+				else
+				{
+					auto createdChain = targetNode_->CreateComponent<CollisionChain2D>();
+					createdChain->SetLoop(static_cast<CollisionChain2D*>(component)->GetLoop());
+					createdChain->SetVertices(createdVertices);
+					createdComponent = createdChain;
+				}
+			}
+			else if (component->IsInstanceOf<CollisionEdge2D>())
+			{
+				auto edge = static_cast<CollisionEdge2D*>(component);
+				auto createdEdge = targetNode_->CreateComponent<CollisionEdge2D>();
+				createdEdge->SetVertices(TransformPoint(edge->GetVertex1(), sourceNode_, targetNode_), TransformPoint(edge->GetVertex2(), sourceNode_, targetNode_));
+				createdComponent = createdEdge;
+			}
+			else
+			{
+				continue;
+			}
+
+			CopyShapeProperties(component, createdComponent);
+			createdComponents_.Push(createdComponent);
+			removedComponents_.Push(SharedPtr<Component>(component));
+			removedComponentIds_.Push(component->GetID());
+			component->Remove();
+		}
+
+		// The body goes last, shapes are still attached to it while being removed.
+		removedComponents_.Push(SharedPtr<Component>(body));
+		removedComponentIds_.Push(body->GetID());
+		body->Remove();
+
+		editorScene_->MarkDirty(sourceNode_);
+		editorScene_->MarkDirty(targetNode_);
+		return true;
+	}
+
+	void MoveCollisionShapesCommand::Undo()
+	{
+		if (removedComponents_.Empty())
+		{
+			return;
+		}
+
+		for (auto createdComponent : createdComponents_)
+		{
+			createdComponent->Remove();
+		}
+
+		// Body first, so the restored shapes find it when they are added back.
+		for (int i = (int)removedComponents_.Size() - 1; i >= 0; i--)
+		{
+			auto id = removedComponentIds_[i];
+			sourceNode_->AddComponent(removedComponents_[i], id, id < FIRST_LOCAL_ID ? REPLICATED : LOCAL);
+		}
+
+		createdComponents_.Clear();
+		removedComponents_.Clear();
+		removedComponentIds_.Clear();
+		editorScene_->MarkDirty(sourceNode_);
+		editorScene_->MarkDirty(targetNode_);
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  ADD VERTEX COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	AddVertexCollisionChain2DCommand::AddVertexCollisionChain2DCommand(EditorScene::Ptr editorScene, Vector2 vertex, unsigned int index)
+	{
+		editorScene_ = editorScene;
+		component_ = nullptr;
+		vertex_ = vertex;
+		index_ = index;
+	}
+
+	bool AddVertexCollisionChain2DCommand::Exec()
+	{
+		auto component = editorScene_->GetSelectedObjectAs<CollisionChain2D>();
+
+		if (component == nullptr)
+		{
+			return false;
+		}
+
+		index_ = Min(index_, component->GetVertexCount());
+		ReplaceVertexRange(component, index_, 0, PODVector<Vector2>(&vertex_, 1));
+		component_ = component;
+		editorScene_->MarkDirty(component_);
+		return true;
+	}
+
+	void AddVertexCollisionChain2DCommand::Undo()
+	{
+		if (component_ != nullptr)
+		{
+			ReplaceVertexRange(component_, index_, 1, PODVector<Vector2>());
+			editorScene_->MarkDirty(component_);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  MOVE VERTEX COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	MoveVertexCollisionChain2DCommand::MoveVertexCollisionChain2DCommand(EditorScene::Ptr editorScene, unsigned int index, Vector2 previousVertex, Vector2 vertex)
+	{
+		editorScene_ = editorScene;
+		component_ = nullptr;
+		index_ = index;
+		previousVertex_ = previousVertex;
+		vertex_ = vertex;
+	}
+
+	bool MoveVertexCollisionChain2DCommand::Exec()
+	{
+		auto component = editorScene_->GetSelectedObjectAs<CollisionChain2D>();
+
+		if (component == nullptr)
+		{
+			return false;
+		}
+
+		if (index_ >= component->GetVertexCount())
+		{
+			return false;
+		}
+
+		ReplaceVertexRange(component, index_, 1, PODVector<Vector2>(&vertex_, 1));
+		component_ = component;
+		editorScene_->MarkDirty(component_);
+		return true;
+	}
+
+	void MoveVertexCollisionChain2DCommand::Undo()
+	{
+		if (component_ != nullptr)
+		{
+			ReplaceVertexRange(component_, index_, 1, PODVector<Vector2>(&previousVertex_, 1));
+			editorScene_->MarkDirty(component_);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  DELETE VERTEX COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	DeleteVertexCollisionChain2DCommand::DeleteVertexCollisionChain2DCommand(EditorScene::Ptr editorScene, unsigned int index)
+	{
+		editorScene_ = editorScene;
+		component_ = nullptr;
+		index_ = index;
+	}
+
+	bool DeleteVertexCollisionChain2DCommand::Exec()
+	{
+		auto component = editorScene_->GetSelectedObjectAs<CollisionChain2D>();
+
+		if (component == nullptr)
+		{
+			return false;
+		}
+
+		if (index_ >= component->GetVertexCount())
+		{
+			return false;
+		}
+
+		vertex_ = component->GetVertex(index_);
+		ReplaceVertexRange(component, index_, 1, PODVector<Vector2>());
+		component_ = component;
+		editorScene_->MarkDirty(component_);
+		return true;
+	}
+
+	void DeleteVertexCollisionChain2DCommand::Undo()
+	{
+		if (component_ != nullptr)
+		{
+			ReplaceVertexRange(component_, index_, 0, PODVector<Vector2>(&vertex_, 1));
+			editorScene_->MarkDirty(component_);
 		}
 	}
 
@@ -615,6 +1468,7 @@ namespace Geode
 		component->SetSize(size_);
 		component->SetCenter(center_);
 		component_ = component;
+		editorScene_->MarkDirty(component_);
 		return true;
 	}
 
@@ -624,6 +1478,7 @@ namespace Geode
 		{
 			component_->SetSize(previousSize_);
 			component_->SetCenter(previousCenter_);
+			editorScene_->MarkDirty(component_);
 		}
 	}
 
@@ -649,6 +1504,7 @@ namespace Geode
 
 		component->SetRadius(radius_);
 		component_ = component;
+		editorScene_->MarkDirty(component_);
 		return true;
 	}
 
@@ -657,6 +1513,7 @@ namespace Geode
 		if (component_ != nullptr)
 		{
 			component_->SetRadius(previousRadius_);
+			editorScene_->MarkDirty(component_);
 		}
 	}
 
@@ -682,6 +1539,7 @@ namespace Geode
 
 		component->SetCenter(center_);
 		component_ = component;
+		editorScene_->MarkDirty(component_);
 		return true;
 	}
 
@@ -690,6 +1548,7 @@ namespace Geode
 		if (component_ != nullptr)
 		{
 			component_->SetCenter(previousCenter_);
+			editorScene_->MarkDirty(component_);
 		}
 	}
 
@@ -716,6 +1575,7 @@ namespace Geode
 
 		serializable->SetAttribute(name_, value_);
 		serializable_ = serializable;
+		editorScene_->MarkDirty(serializable_);
 		return true;
 	}
 
@@ -724,6 +1584,7 @@ namespace Geode
 		if (serializable_ != nullptr)
 		{
 			serializable_->SetAttribute(name_, previousValue_);
+			editorScene_->MarkDirty(serializable_);
 		}
 	}
 }
\ No newline at end of file
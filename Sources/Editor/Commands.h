@@ -23,6 +23,7 @@
 #include <Urho3D/Urho2D/CollisionBox2D.h>
 #include <Urho3D/Urho2D/CollisionPolygon2D.h>
 #include <Urho3D/Urho2D/CollisionCircle2D.h>
+#include <Urho3D/Urho2D/CollisionChain2D.h>
 
 namespace Geode
 {
@@ -87,6 +88,23 @@ namespace Geode
 		Geode::CommandHistory::Ptr commandHistory_;
 	};
 
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  COMPOUND COMMAND
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class CompoundCommand : public ICommand
+	{
+	public:
+		CompoundCommand();
+		void Add(Geode::ICommand::Ptr command);
+		unsigned GetNumCommands() const;
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Urho3D::Vector<Geode::ICommand::Ptr> commands_;
+		Urho3D::Vector<Geode::ICommand::Ptr> executedCommands_;
+	};
+
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	///  UNSELECT COMMAND
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,54 +152,34 @@ namespace Geode
 	};
 
 	///////////////////////////////////////////////////////////////////////////////////////////////////
-	///  MOVE NODE COMMAND
+	///  TRANSFORM NODES COMMAND
 	///////////////////////////////////////////////////////////////////////////////////////////////////
-	class MoveNodeCommand : public ICommand
-	{
-	public:
-		explicit MoveNodeCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Vector2 previousPosition, Urho3D::Vector2 position);
-		bool Exec() override;
-		void Undo() override;
-
-	private:
-		Geode::EditorScene::Ptr editorScene_;
-		Urho3D::Vector2 previousPosition_;
-		Urho3D::Vector2 position_;
-		Urho3D::Node* movedNode_;
+	struct NodeTransform2D {
+		Urho3D::Vector2 position;
+		float rotation;
+		Urho3D::Vector2 scale;
 	};
 
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	///  SCALE NODE COMMAND
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	class ScaleNodeCommand : public ICommand
+	class TransformNodesCommand : public ICommand
 	{
 	public:
-		explicit ScaleNodeCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Vector2 previousScale, Urho3D::Vector2 scale);
+		explicit TransformNodesCommand(Geode::EditorScene::Ptr editorScene, const Urho3D::PODVector<Urho3D::Node*>& nodes, const Urho3D::Vector<Geode::NodeTransform2D>& previousTransforms, const Urho3D::Vector<Geode::NodeTransform2D>& transforms);
 		bool Exec() override;
 		void Undo() override;
 
-	private:
-		Geode::EditorScene::Ptr editorScene_;
-		Urho3D::Vector2 previousScale_;
-		Urho3D::Vector2 scale_;
-		Urho3D::Node* scaledNode_;
-	};
+		static Geode::NodeTransform2D GetWorldTransform(Urho3D::Node* node);
+		static void SetWorldTransform(Urho3D::Node* node, const Geode::NodeTransform2D& transform);
+		static void GetSelectedWorldTransforms(Geode::EditorScene* editorScene, Urho3D::PODVector<Urho3D::Node*>& nodes, Urho3D::Vector<Geode::NodeTransform2D>& transforms);
+		static void SetWorldTransforms(const Urho3D::PODVector<Urho3D::Node*>& nodes, const Urho3D::Vector<Geode::NodeTransform2D>& transforms);
 
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	///  ROTATE NODE COMMAND
-	///////////////////////////////////////////////////////////////////////////////////////////////////
-	class RotateNodeCommand : public ICommand
-	{
-	public:
-		explicit RotateNodeCommand(Geode::EditorScene::Ptr editorScene, float previousRotation, float rotation);
-		bool Exec() override;
-		void Undo() override;
+	private:
+		void Apply(const Urho3D::Vector<Geode::NodeTransform2D>& transforms);
 
 	private:
 		Geode::EditorScene::Ptr editorScene_;
-		float previousRotation_;
-		float rotation_;
-		Urho3D::Node* rotatedNode_;
+		Urho3D::PODVector<Urho3D::Node*> nodes_;
+		Urho3D::Vector<Geode::NodeTransform2D> previousTransforms_;
+		Urho3D::Vector<Geode::NodeTransform2D> transforms_;
 	};
 
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,13 +257,28 @@ namespace Geode
 		Urho3D::CollisionCircle2D* createdComponent_;
 	};
 
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  CREATE COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class CreateCollisionChain2DCommand : public ICommand
+	{
+	public:
+		explicit CreateCollisionChain2DCommand(Geode::EditorScene::Ptr editorScene);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::CollisionChain2D* createdComponent_;
+	};
+
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	///  ADD VERTEX COLLISIONPOLYGON2D
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	class AddVertexCollisionPolygon2DCommand : public ICommand
 	{
 	public:
-		explicit AddVertexCollisionPolygon2DCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Vector2 vertex);
+		explicit AddVertexCollisionPolygon2DCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Vector2 vertex, unsigned int index);
 		bool Exec() override;
 		void Undo() override;
 
@@ -273,6 +286,7 @@ namespace Geode
 		Geode::EditorScene::Ptr editorScene_;
 		Urho3D::CollisionPolygon2D* component_;
 		Urho3D::Vector2 vertex_;
+		unsigned int index_;
 	};
 
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +324,183 @@ namespace Geode
 		unsigned int index_;
 	};
 
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  DECOMPOSE COLLISIONPOLYGON2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class DecomposeCollisionPolygon2DCommand : public ICommand
+	{
+	public:
+		explicit DecomposeCollisionPolygon2DCommand(Geode::EditorScene::Ptr editorScene);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::Node* node_;
+		Urho3D::SharedPtr<Urho3D::CollisionPolygon2D> removedComponent_;
+		unsigned removedComponentId_;
+		Urho3D::PODVector<Urho3D::CollisionPolygon2D*> createdComponents_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  GENERATE COLLISIONPOLYGON2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class GenerateCollisionPolygon2DCommand : public ICommand
+	{
+	public:
+		explicit GenerateCollisionPolygon2DCommand(Geode::EditorScene::Ptr editorScene);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::Node* node_;
+		Urho3D::PODVector<Urho3D::CollisionPolygon2D*> createdComponents_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  REPLACE COLLISIONPOLYGON2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class ReplaceCollisionPolygon2DCommand : public ICommand
+	{
+	public:
+		explicit ReplaceCollisionPolygon2DCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Node* node, const Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& pieces);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::Node* node_;
+		Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>> pieces_;
+		Urho3D::Vector<Urho3D::SharedPtr<Urho3D::CollisionPolygon2D>> removedComponents_;
+		Urho3D::PODVector<unsigned> removedComponentIds_;
+		Urho3D::PODVector<Urho3D::CollisionPolygon2D*> createdComponents_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  SIMPLIFY COLLISION SHAPE
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class SimplifyCollisionShapeCommand : public ICommand
+	{
+	public:
+		explicit SimplifyCollisionShapeCommand(Geode::EditorScene::Ptr editorScene, float maxDeviation);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		float maxDeviation_;
+		Urho3D::CollisionPolygon2D* polygon_;
+		Urho3D::CollisionChain2D* chain_;
+		Urho3D::PODVector<Urho3D::Vector2> previousVertices_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  MERGE STATIC COLLIDERS
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class MergeStaticCollidersCommand : public ICommand
+	{
+	public:
+		explicit MergeStaticCollidersCommand(Geode::EditorScene::Ptr editorScene, bool useChains);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		bool useChains_;
+		Urho3D::Node* createdNode_;
+		Urho3D::Vector<Urho3D::SharedPtr<Urho3D::CollisionShape2D>> removedComponents_;
+		Urho3D::PODVector<Urho3D::Node*> removedComponentNodes_;
+		Urho3D::PODVector<unsigned> removedComponentIds_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  ATTACH NODE
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class AttachNodeCommand : public ICommand
+	{
+	public:
+		explicit AttachNodeCommand(Geode::EditorScene::Ptr editorScene, Urho3D::SharedPtr<Urho3D::Node> node, Urho3D::Node* parentNode);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::SharedPtr<Urho3D::Node> node_;
+		Urho3D::Node* parentNode_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  MOVE COLLISION SHAPES
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class MoveCollisionShapesCommand : public ICommand
+	{
+	public:
+		explicit MoveCollisionShapesCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Node* sourceNode, Urho3D::Node* targetNode);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::Node* sourceNode_;
+		Urho3D::Node* targetNode_;
+		Urho3D::Vector<Urho3D::SharedPtr<Urho3D::Component>> removedComponents_;
+		Urho3D::PODVector<unsigned> removedComponentIds_;
+		Urho3D::PODVector<Urho3D::CollisionShape2D*> createdComponents_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  ADD VERTEX COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class AddVertexCollisionChain2DCommand : public ICommand
+	{
+	public:
+		explicit AddVertexCollisionChain2DCommand(Geode::EditorScene::Ptr editorScene, Urho3D::Vector2 vertex, unsigned int index);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::CollisionChain2D* component_;
+		Urho3D::Vector2 vertex_;
+		unsigned int index_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  MOVE VERTEX COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class MoveVertexCollisionChain2DCommand : public ICommand
+	{
+	public:
+		explicit MoveVertexCollisionChain2DCommand(Geode::EditorScene::Ptr editorScene, unsigned int index, Urho3D::Vector2 previousVertex, Urho3D::Vector2 vertex);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::CollisionChain2D* component_;
+		Urho3D::Vector2 previousVertex_;
+		Urho3D::Vector2 vertex_;
+		unsigned int index_;
+	};
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	///  DELETE VERTEX COLLISIONCHAIN2D
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	class DeleteVertexCollisionChain2DCommand : public ICommand
+	{
+	public:
+		explicit DeleteVertexCollisionChain2DCommand(Geode::EditorScene::Ptr editorScene, unsigned int index);
+		bool Exec() override;
+		void Undo() override;
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::CollisionChain2D* component_;
+		Urho3D::Vector2 vertex_;
+		unsigned int index_;
+	};
+
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	///  CHANGE SIZE CENTER COLLISIONBOX2D
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,450 @@
+#include "ConvexDecomposition.h"
+#include "CollisionShapeGeometry.h"
+#include "GridCells.h"
+
+#include <Urho3D/Math/Rect.h>
+
+using namespace Urho3D;
+
+static const float POINT_EPSILON = 1e-6f;
+static const float MIN_PIECE_AREA = 1e-5f;
+
+static inline float Cross(const Vector2& a, const Vector2& b, const Vector2& c)
+{
+	return (b.x_ - a.x_) * (c.y_ - a.y_) - (b.y_ - a.y_) * (c.x_ - a.x_);
+}
+
+static inline unsigned long long EdgeKey(unsigned a, unsigned b)
+{
+	return a < b ? ((unsigned long long)a << 32) | b : ((unsigned long long)b << 32) | a;
+}
+
+namespace Geode
+{
+	ConvexDecomposition::ConvexDecomposition(Context* context) : Object(context)
+	{
+		maxVertices_ = CollisionShapeGeometry::MAX_POLYGON_VERTICES;
+		numRemaining_ = 0;
+		numReflex_ = 0;
+		cellSize_ = 1.0f;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void ConvexDecomposition::SetMaxVertices(unsigned maxVertices)
+	{
+		maxVertices_ = Max(maxVertices, 3U);
+	}
+
+	unsigned ConvexDecomposition::GetMaxVertices() const
+	{
+		return maxVertices_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool ConvexDecomposition::Decompose(const PODVector<Vector2>& vertices, Vector<PODVector<Vector2>>& dest)
+	{
+		dest.Clear();
+
+		// Ear clipping, then adjacent triangles are merged while they stay convex (Hertel-Mehlhorn),
+		// at most four times the optimal piece count and close to it on real outlines.
+		PrepareOutline(vertices);
+
+		if (numRemaining_ < 3 || !Triangulate())
+		{
+			return false;
+		}
+
+		MergePieces();
+
+		for (unsigned i = 0; i < pieces_.Size(); i++)
+		{
+			if (pieceParents_[i] != i)
+			{
+				continue;
+			}
+
+			PODVector<Vector2> piece;
+			auto area = 0.0f;
+
+			for (auto index : pieces_[i])
+			{
+				piece.Push(points_[index]);
+			}
+
+			for (unsigned j = 0; j < piece.Size(); j++)
+			{
+				area += piece[j].CrossProduct(piece[(j + 1) % piece.Size()]);
+			}
+
+			// Slivers would be welded below three vertices by Box2D.
+			if (area * 0.5f >= MIN_PIECE_AREA)
+			{
+				dest.Push(piece);
+			}
+		}
+
+		return !dest.Empty();
+	}
+
+	bool ConvexDecomposition::IsConvex(const PODVector<Vector2>& vertices)
+	{
+		auto numVertices = vertices.Size();
+		auto sign = 0.0f;
+
+		if (numVertices < 3)
+		{
+			return false;
+		}
+
+		for (unsigned i = 0; i < numVertices; i++)
+		{
+			auto cross = Cross(vertices[(i + numVertices - 1) % numVertices], vertices[i], vertices[(i + 1) % numVertices]);
+
+			if (Abs(cross) <= POINT_EPSILON)
+			{
+				continue;
+			}
+
+			if (sign == 0.0f)
+			{
+				sign = cross;
+			}
+			else if ((cross > 0.0f) != (sign > 0.0f))
+			{
+				return false;
+			}
+		}
+
+		return sign != 0.0f;
+	}
+
+	void ConvexDecomposition::PrepareOutline(const PODVector<Vector2>& vertices)
+	{
+		auto area = 0.0f;
+
+		points_.Clear();
+
+		for (auto& vertex : vertices)
+		{
+			if (points_.Empty() || (vertex - points_.Back()).LengthSquared() > POINT_EPSILON)
+			{
+				points_.Push(vertex);
+			}
+		}
+
+		while (points_.Size() > 1 && (points_.Front() - points_.Back()).LengthSquared() <= POINT_EPSILON)
+		{
+			points_.Pop();
+		}
+
+		for (unsigned i = 0; i < points_.Size(); i++)
+		{
+			area += points_[i].CrossProduct(points_[(i + 1) % points_.Size()]);
+		}
+
+		// Everything below works on a counter clockwise outline.
+		if (area < 0.0f)
+		{
+			for (unsigned i = 0; i < points_.Size() / 2; i++)
+			{
+				Swap(points_[i], points_[points_.Size() - 1 - i]);
+			}
+		}
+
+		auto numPoints = points_.Size();
+		prev_.Resize(numPoints);
+		next_.Resize(numPoints);
+		reflex_.Resize(numPoints);
+		numRemaining_ = numPoints;
+
+		for (unsigned i = 0; i < numPoints; i++)
+		{
+			prev_[i] = (i + numPoints - 1) % numPoints;
+			next_[i] = (i + 1) % numPoints;
+		}
+
+		// Collinear vertices would produce flat triangles.
+		for (unsigned i = 0; i < numPoints && numRemaining_ > 3; i++)
+		{
+			if (Abs(Cross(points_[prev_[i]], points_[i], points_[next_[i]])) <= POINT_EPSILON)
+			{
+				next_[prev_[i]] = next_[i];
+				prev_[next_[i]] = prev_[i];
+				next_[i] = prev_[i] = M_MAX_UNSIGNED;
+				numRemaining_--;
+			}
+		}
+	}
+
+	bool ConvexDecomposition::Triangulate()
+	{
+		auto numPoints = points_.Size();
+		auto start = 0U;
+		auto totalLength = 0.0f;
+
+		pieces_.Clear();
+		diagonals_.Clear();
+		openDiagonals_.Clear();
+		reflexCells_.Clear();
+		numReflex_ = 0;
+
+		while (next_[start] == M_MAX_UNSIGNED)
+		{
+			start++;
+		}
+
+		// Only reflex vertices can fall inside an ear, they are bucketed so an ear test only looks at its neighbourhood.
+		auto index = start;
+		auto bounds = Rect(points_[start], points_[start]);
+
+		do
+		{
+			totalLength += (points_[next_[index]] - points_[index]).Length();
+			bounds.Merge(points_[index]);
+			index = next_[index];
+		} while (index != start);
+
+		// Spiky outlines have long edges over a small area, whichever gives the smaller cells wins.
+		auto boundsSize = bounds.Size();
+		cellSize_ = Max(Min(totalLength / numRemaining_, Sqrt(boundsSize.x_ * boundsSize.y_ / numRemaining_)) * 2.0f, POINT_EPSILON);
+
+		for (unsigned i = 0; i < numPoints; i++)
+		{
+			reflex_[i] = next_[i] != M_MAX_UNSIGNED && IsReflex(i);
+
+			if (reflex_[i])
+			{
+				reflexCells_[GetCellCoords(points_[i])].Push(i);
+				numReflex_++;
+			}
+		}
+
+		auto current = start;
+		auto numFailures = 0U;
+
+		while (numRemaining_ > 3)
+		{
+			if (IsEar(current))
+			{
+				auto p = prev_[current];
+				auto n = next_[current];
+
+				AddPiece(p, current, n);
+				next_[p] = n;
+				prev_[n] = p;
+				next_[current] = prev_[current] = M_MAX_UNSIGNED;
+				numRemaining_--;
+
+				// Clipping only ever makes a reflex neighbour convex, stale cell entries are skipped by the flag.
+				unsigned neighbours[] = { p, n };
+
+				for (auto neighbour : neighbours)
+				{
+					if (reflex_[neighbour] && !IsReflex(neighbour))
+					{
+						reflex_[neighbour] = false;
+						numReflex_--;
+					}
+				}
+
+				current = p;
+				numFailures = 0;
+			}
+			else
+			{
+				current = next_[current];
+
+				// A full turn without an ear, the outline crosses itself.
+				if (++numFailures > numRemaining_)
+				{
+					return false;
+				}
+			}
+		}
+
+		AddPiece(prev_[current], current, next_[current]);
+		return true;
+	}
+
+	void ConvexDecomposition::MergePieces()
+	{
+		pieceParents_.Resize(pieces_.Size());
+
+		for (unsigned i = 0; i < pieces_.Size(); i++)
+		{
+			pieceParents_[i] = i;
+		}
+
+		auto findRoot = [this](unsigned piece)
+		{
+			while (pieceParents_[piece] != piece)
+			{
+				pieceParents_[piece] = pieceParents_[pieceParents_[piece]];
+				piece = pieceParents_[piece];
+			}
+
+			return piece;
+		};
+
+		PODVector<unsigned> merged;
+
+		for (auto& diagonal : diagonals_)
+		{
+			auto first = findRoot(diagonal.firstPiece);
+			auto second = findRoot(diagonal.secondPiece);
+			auto& firstPiece = pieces_[first];
+			auto& secondPiece = pieces_[second];
+
+			if (first == second || firstPiece.Size() + secondPiece.Size() - 2 > maxVertices_)
+			{
+				continue;
+			}
+
+			// Pieces stay counter clockwise, the newer one runs a to b and the older one b to a.
+			// Both are rotated so the first runs b..a and the second a..b, the merge is their concatenation.
+			auto firstStart = 0U;
+			auto secondStart = 0U;
+
+			while (firstStart < firstPiece.Size() && !(firstPiece[firstStart] == diagonal.b && firstPiece[(firstStart + firstPiece.Size() - 1) % firstPiece.Size()] == diagonal.a))
+			{
+				firstStart++;
+			}
+
+			while (secondStart < secondPiece.Size() && !(secondPiece[secondStart] == diagonal.a && secondPiece[(secondStart + secondPiece.Size() - 1) % secondPiece.Size()] == diagonal.b))
+			{
+				secondStart++;
+			}
+
+			if (firstStart == firstPiece.Size() || secondStart == secondPiece.Size())
+			{
+				continue;
+			}
+
+			merged.Clear();
+
+			for (unsigned i = 0; i < firstPiece.Size(); i++)
+			{
+				merged.Push(firstPiece[(firstStart + i) % firstPiece.Size()]);
+			}
+
+			for (unsigned i = 1; i + 1 < secondPiece.Size(); i++)
+			{
+				merged.Push(secondPiece[(secondStart + i) % secondPiece.Size()]);
+			}
+
+			// Every corner is tested, near flat triangles can hide a slightly reflex one away from the joints.
+			auto numMerged = merged.Size();
+			auto convex = true;
+
+			for (unsigned i = 0; i < numMerged && convex; i++)
+			{
+				convex = Cross(points_[merged[(i + numMerged - 1) % numMerged]], points_[merged[i]], points_[merged[(i + 1) % numMerged]]) >= 0.0f;
+			}
+
+			if (convex)
+			{
+				firstPiece = merged;
+				secondPiece.Clear();
+				pieceParents_[second] = first;
+			}
+		}
+	}
+
+	bool ConvexDecomposition::IsReflex(unsigned index) const
+	{
+		// Collinear vertices count as convex, clipping them only leaves a flat piece merged right after.
+		return Cross(points_[prev_[index]], points_[index], points_[next_[index]]) < 0.0f;
+	}
+
+	bool ConvexDecomposition::IsEar(unsigned index) const
+	{
+		if (reflex_[index])
+		{
+			return false;
+		}
+
+		// Convex outlines (circles, rounded boxes) have nothing to test against.
+		if (numReflex_ == 0)
+		{
+			return true;
+		}
+
+		auto p = prev_[index];
+		auto n = next_[index];
+		auto& a = points_[p];
+		auto& b = points_[index];
+		auto& c = points_[n];
+		auto minCoords = GetCellCoords(Vector2(Min(a.x_, Min(b.x_, c.x_)), Min(a.y_, Min(b.y_, c.y_))));
+		auto maxCoords = GetCellCoords(Vector2(Max(a.x_, Max(b.x_, c.x_)), Max(a.y_, Max(b.y_, c.y_))));
+		auto blocked = false;
+
+		GridCells::Visit(reflexCells_, minCoords, maxCoords, [&](const PODVector<unsigned>& cell)
+		{
+			for (auto other : cell)
+			{
+				if (blocked || !reflex_[other] || other == p || other == n)
+				{
+					continue;
+				}
+
+				auto& point = points_[other];
+
+				// Reflex vertices sharing a corner position (pinched outlines) don't block the ear.
+				if ((point - a).LengthSquared() <= POINT_EPSILON || (point - c).LengthSquared() <= POINT_EPSILON)
+				{
+					continue;
+				}
+
+				blocked = Cross(a, b, point) >= 0.0f && Cross(b, c, point) >= 0.0f && Cross(c, a, point) >= 0.0f;
+			}
+		});
+
+		return !blocked;
+	}
+
+	IntVector2 ConvexDecomposition::GetCellCoords(const Vector2& position) const
+	{
+		return IntVector2(FloorToInt(position.x_ / cellSize_), FloorToInt(position.y_ / cellSize_));
+	}
+
+	void ConvexDecomposition::AddPiece(unsigned a, unsigned b, unsigned c)
+	{
+		auto pieceIndex = pieces_.Size();
+		unsigned corners[] = { a, b, c };
+
+		pieces_.Resize(pieceIndex + 1);
+		pieces_.Back().Push(corners[0]);
+		pieces_.Back().Push(corners[1]);
+		pieces_.Back().Push(corners[2]);
+
+		// Each triangle edge is either an outline edge or a diagonal clipped earlier, the closing one is left open.
+		for (unsigned i = 0; i < 3; i++)
+		{
+			auto from = corners[i];
+			auto to = corners[(i + 1) % 3];
+			auto key = EdgeKey(from, to);
+			auto diagonalIt = openDiagonals_.Find(key);
+
+			if (diagonalIt != openDiagonals_.End())
+			{
+				Diagonal diagonal;
+				diagonal.a = from;
+				diagonal.b = to;
+				diagonal.firstPiece = pieceIndex;
+				diagonal.secondPiece = diagonalIt->second_;
+				diagonals_.Push(diagonal);
+				openDiagonals_.Erase(diagonalIt);
+			}
+			else if (from == c && to == a)
+			{
+				openDiagonals_[key] = pieceIndex;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * @file    ConvexDecomposition.h
+ * @ingroup Editor
+ * @brief   Split of a simple polygon outline into convex pieces Box2D accepts.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Math/Vector2.h>
+
+namespace Geode
+{
+	class ConvexDecomposition : public Urho3D::Object
+	{
+		URHO3D_OBJECT(ConvexDecomposition, Urho3D::Object)
+
+		struct Diagonal {
+			unsigned a;
+			unsigned b;
+			unsigned firstPiece;
+			unsigned secondPiece;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<ConvexDecomposition>;
+
+	public:
+		/// Constructors.
+		explicit ConvexDecomposition(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetMaxVertices(unsigned maxVertices);
+		unsigned GetMaxVertices() const;
+
+		/// Other methods.
+		bool Decompose(const Urho3D::PODVector<Urho3D::Vector2>& vertices, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& dest);
+		static bool IsConvex(const Urho3D::PODVector<Urho3D::Vector2>& vertices);
+
+	private:
+		/// Other methods.
+		void PrepareOutline(const Urho3D::PODVector<Urho3D::Vector2>& vertices);
+		bool Triangulate();
+		void MergePieces();
+		bool IsReflex(unsigned index) const;
+		bool IsEar(unsigned index) const;
+		Urho3D::IntVector2 GetCellCoords(const Urho3D::Vector2& position) const;
+		void AddPiece(unsigned a, unsigned b, unsigned c);
+
+	private:
+		unsigned maxVertices_;
+		Urho3D::PODVector<Urho3D::Vector2> points_;
+		Urho3D::PODVector<unsigned> prev_;
+		Urho3D::PODVector<unsigned> next_;
+		Urho3D::PODVector<bool> reflex_;
+		unsigned numRemaining_;
+		unsigned numReflex_;
+		float cellSize_;
+		Urho3D::HashMap<Urho3D::IntVector2, Urho3D::PODVector<unsigned>> reflexCells_;
+		Urho3D::Vector<Urho3D::PODVector<unsigned>> pieces_;
+		Urho3D::PODVector<unsigned> pieceParents_;
+		Urho3D::PODVector<Diagonal> diagonals_;
+		Urho3D::HashMap<unsigned long long, unsigned> openDiagonals_;
+	};
+}
\ No newline at end of file
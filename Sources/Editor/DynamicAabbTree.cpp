@@ -0,0 +1,317 @@
+#include "DynamicAabbTree.h"
+
+using namespace Urho3D;
+
+static const float DEFAULT_MARGIN = 0.1f;
+
+static inline float GetPerimeter(const Rect& rect)
+{
+	return 2.0f * (rect.max_.x_ - rect.min_.x_ + rect.max_.y_ - rect.min_.y_);
+}
+
+static inline Rect GetUnion(const Rect& a, const Rect& b)
+{
+	return Rect(Min(a.min_.x_, b.min_.x_), Min(a.min_.y_, b.min_.y_), Max(a.max_.x_, b.max_.x_), Max(a.max_.y_, b.max_.y_));
+}
+
+static inline bool Contains(const Rect& outer, const Rect& inner)
+{
+	return outer.min_.x_ <= inner.min_.x_ && outer.min_.y_ <= inner.min_.y_ && inner.max_.x_ <= outer.max_.x_ && inner.max_.y_ <= outer.max_.y_;
+}
+
+namespace Geode
+{
+	DynamicAabbTree::DynamicAabbTree()
+	{
+		margin_ = DEFAULT_MARGIN;
+		root_ = NULL_NODE;
+		freeList_ = NULL_NODE;
+		numProxies_ = 0;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void DynamicAabbTree::SetMargin(float margin)
+	{
+		margin_ = margin;
+	}
+
+	float DynamicAabbTree::GetMargin() const
+	{
+		return margin_;
+	}
+
+	void DynamicAabbTree::SetUserData(unsigned proxy, unsigned userData)
+	{
+		nodes_[proxy].userData = userData;
+	}
+
+	unsigned DynamicAabbTree::GetUserData(unsigned proxy) const
+	{
+		return nodes_[proxy].userData;
+	}
+
+	const Rect& DynamicAabbTree::GetFatRect(unsigned proxy) const
+	{
+		return nodes_[proxy].rect;
+	}
+
+	unsigned DynamicAabbTree::GetNumProxies() const
+	{
+		return numProxies_;
+	}
+
+	int DynamicAabbTree::GetHeight() const
+	{
+		return root_ != NULL_NODE ? nodes_[root_].height : 0;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	unsigned DynamicAabbTree::CreateProxy(const Rect& rect, unsigned userData)
+	{
+		auto proxy = AllocateNode();
+		nodes_[proxy].rect = Rect(rect.min_ - Vector2(margin_, margin_), rect.max_ + Vector2(margin_, margin_));
+		nodes_[proxy].userData = userData;
+		nodes_[proxy].height = 0;
+
+		InsertLeaf(proxy);
+		numProxies_++;
+		return proxy;
+	}
+
+	void DynamicAabbTree::DestroyProxy(unsigned proxy)
+	{
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		numProxies_--;
+	}
+
+	bool DynamicAabbTree::MoveProxy(unsigned proxy, const Rect& rect)
+	{
+		// The fat rect absorbs small moves, the tree is only touched when the shape leaves it.
+		if (Contains(nodes_[proxy].rect, rect))
+		{
+			return false;
+		}
+
+		RemoveLeaf(proxy);
+		nodes_[proxy].rect = Rect(rect.min_ - Vector2(margin_, margin_), rect.max_ + Vector2(margin_, margin_));
+		InsertLeaf(proxy);
+		return true;
+	}
+
+	void DynamicAabbTree::Clear()
+	{
+		nodes_.Clear();
+		root_ = NULL_NODE;
+		freeList_ = NULL_NODE;
+		numProxies_ = 0;
+	}
+
+	unsigned DynamicAabbTree::AllocateNode()
+	{
+		unsigned index;
+
+		if (freeList_ != NULL_NODE)
+		{
+			index = freeList_;
+			freeList_ = nodes_[index].parent;
+		}
+		else
+		{
+			index = nodes_.Size();
+			nodes_.Resize(index + 1);
+		}
+
+		nodes_[index].parent = NULL_NODE;
+		nodes_[index].child1 = NULL_NODE;
+		nodes_[index].child2 = NULL_NODE;
+		nodes_[index].height = 0;
+		nodes_[index].userData = NULL_NODE;
+		return index;
+	}
+
+	void DynamicAabbTree::FreeNode(unsigned index)
+	{
+		// Free nodes are chained through their parent index.
+		nodes_[index].parent = freeList_;
+		nodes_[index].height = -1;
+		freeList_ = index;
+	}
+
+	void DynamicAabbTree::InsertLeaf(unsigned leaf)
+	{
+		if (root_ == NULL_NODE)
+		{
+			root_ = leaf;
+			nodes_[root_].parent = NULL_NODE;
+			return;
+		}
+
+		// Walk down to the sibling with the cheapest growth of the summed perimeters.
+		auto leafRect = nodes_[leaf].rect;
+		auto index = root_;
+
+		while (nodes_[index].child1 != NULL_NODE)
+		{
+			auto child1 = nodes_[index].child1;
+			auto child2 = nodes_[index].child2;
+			auto perimeter = GetPerimeter(nodes_[index].rect);
+			auto combinedPerimeter = GetPerimeter(GetUnion(nodes_[index].rect, leafRect));
+			auto cost = 2.0f * combinedPerimeter;
+			auto inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+			auto cost1 = GetPerimeter(GetUnion(leafRect, nodes_[child1].rect)) + inheritanceCost;
+			auto cost2 = GetPerimeter(GetUnion(leafRect, nodes_[child2].rect)) + inheritanceCost;
+
+			if (nodes_[child1].child1 != NULL_NODE)
+			{
+				cost1 -= GetPerimeter(nodes_[child1].rect);
+			}
+
+			if (nodes_[child2].child1 != NULL_NODE)
+			{
+				cost2 -= GetPerimeter(nodes_[child2].rect);
+			}
+
+			if (cost < cost1 && cost < cost2)
+			{
+				break;
+			}
+
+			index = cost1 < cost2 ? child1 : child2;
+		}
+
+		auto sibling = index;
+		auto oldParent = nodes_[sibling].parent;
+		auto newParent = AllocateNode();
+		nodes_[newParent].parent = oldParent;
+		nodes_[newParent].rect = GetUnion(leafRect, nodes_[sibling].rect);
+		nodes_[newParent].height = nodes_[sibling].height + 1;
+		nodes_[newParent].child1 = sibling;
+		nodes_[newParent].child2 = leaf;
+		nodes_[sibling].parent = newParent;
+		nodes_[leaf].parent = newParent;
+
+		if (oldParent == NULL_NODE)
+		{
+			root_ = newParent;
+		}
+		else if (nodes_[oldParent].child1 == sibling)
+		{
+			nodes_[oldParent].child1 = newParent;
+		}
+		else
+		{
+			nodes_[oldParent].child2 = newParent;
+		}
+
+		for (index = nodes_[leaf].parent; index != NULL_NODE; index = nodes_[index].parent)
+		{
+			index = Balance(index);
+			UpdateNode(index);
+		}
+	}
+
+	void DynamicAabbTree::RemoveLeaf(unsigned leaf)
+	{
+		if (leaf == root_)
+		{
+			root_ = NULL_NODE;
+			return;
+		}
+
+		auto parent = nodes_[leaf].parent;
+		auto grandParent = nodes_[parent].parent;
+		auto sibling = nodes_[parent].child1 == leaf ? nodes_[parent].child2 : nodes_[parent].child1;
+
+		FreeNode(parent);
+
+		if (grandParent == NULL_NODE)
+		{
+			root_ = sibling;
+			nodes_[sibling].parent = NULL_NODE;
+			return;
+		}
+
+		if (nodes_[grandParent].child1 == parent)
+		{
+			nodes_[grandParent].child1 = sibling;
+		}
+		else
+		{
+			nodes_[grandParent].child2 = sibling;
+		}
+
+		nodes_[sibling].parent = grandParent;
+
+		for (auto index = grandParent; index != NULL_NODE; index = nodes_[index].parent)
+		{
+			index = Balance(index);
+			UpdateNode(index);
+		}
+	}
+
+	unsigned DynamicAabbTree::Balance(unsigned a)
+	{
+		if (nodes_[a].child1 == NULL_NODE || nodes_[a].height < 2)
+		{
+			return a;
+		}
+
+		auto b = nodes_[a].child1;
+		auto c = nodes_[a].child2;
+		auto balance = nodes_[c].height - nodes_[b].height;
+
+		if (balance >= -1 && balance <= 1)
+		{
+			return a;
+		}
+
+		// The taller child takes the place of a, and a keeps the shorter grandchild.
+		auto up = balance > 1 ? c : b;
+		auto other = balance > 1 ? b : c;
+		auto child1 = nodes_[up].child1;
+		auto child2 = nodes_[up].child2;
+		auto kept = nodes_[child1].height > nodes_[child2].height ? child1 : child2;
+		auto moved = kept == child1 ? child2 : child1;
+
+		nodes_[up].child1 = a;
+		nodes_[up].child2 = kept;
+		nodes_[up].parent = nodes_[a].parent;
+		nodes_[a].parent = up;
+
+		if (nodes_[up].parent == NULL_NODE)
+		{
+			root_ = up;
+		}
+		else if (nodes_[nodes_[up].parent].child1 == a)
+		{
+			nodes_[nodes_[up].parent].child1 = up;
+		}
+		else
+		{
+			nodes_[nodes_[up].parent].child2 = up;
+		}
+
+		nodes_[a].child1 = other;
+		nodes_[a].child2 = moved;
+		nodes_[moved].parent = a;
+
+		UpdateNode(a);
+		UpdateNode(up);
+		return up;
+	}
+
+	void DynamicAabbTree::UpdateNode(unsigned index)
+	{
+		auto child1 = nodes_[index].child1;
+		auto child2 = nodes_[index].child2;
+		nodes_[index].height = 1 + Max(nodes_[child1].height, nodes_[child2].height);
+		nodes_[index].rect = GetUnion(nodes_[child1].rect, nodes_[child2].rect);
+	}
+}
\ No newline at end of file
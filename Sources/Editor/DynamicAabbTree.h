@@ -0,0 +1,107 @@
+/**
+ * @file    DynamicAabbTree.h
+ * @ingroup Editor
+ * @brief   Balanced bounding volume tree of fattened rects, updated in place as they move.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Container/Vector.h>
+#include <Urho3D/Math/Rect.h>
+
+namespace Geode
+{
+	class DynamicAabbTree
+	{
+		struct TreeNode {
+			Urho3D::Rect rect;
+			unsigned parent;
+			unsigned child1;
+			unsigned child2;
+			int height;
+			unsigned userData;
+		};
+
+	public:
+		static const unsigned NULL_NODE = 0xffffffff;
+
+	public:
+		/// Constructors.
+		DynamicAabbTree();
+
+		/// Accessors & Mutators.
+		void SetMargin(float margin);
+		float GetMargin() const;
+		void SetUserData(unsigned proxy, unsigned userData);
+		unsigned GetUserData(unsigned proxy) const;
+		const Urho3D::Rect& GetFatRect(unsigned proxy) const;
+		unsigned GetNumProxies() const;
+		int GetHeight() const;
+
+		/// Other methods.
+		unsigned CreateProxy(const Urho3D::Rect& rect, unsigned userData);
+		void DestroyProxy(unsigned proxy);
+		bool MoveProxy(unsigned proxy, const Urho3D::Rect& rect);
+		void Clear();
+		template<typename T> void Query(const Urho3D::Rect& rect, T callback) const;
+
+	private:
+		/// Other methods.
+		unsigned AllocateNode();
+		void FreeNode(unsigned index);
+		void InsertLeaf(unsigned leaf);
+		void RemoveLeaf(unsigned leaf);
+		unsigned Balance(unsigned index);
+		void UpdateNode(unsigned index);
+
+	private:
+		float margin_;
+		unsigned root_;
+		unsigned freeList_;
+		unsigned numProxies_;
+		Urho3D::PODVector<TreeNode> nodes_;
+		mutable Urho3D::PODVector<unsigned> stack_;
+	};
+}
+
+namespace Geode
+{
+	template<typename T>
+	void DynamicAabbTree::Query(const Urho3D::Rect& rect, T callback) const
+	{
+		stack_.Clear();
+		stack_.Push(root_);
+
+		while (!stack_.Empty())
+		{
+			auto index = stack_.Back();
+			stack_.Pop();
+
+			if (index == NULL_NODE)
+			{
+				continue;
+			}
+
+			auto& node = nodes_[index];
+
+			if (node.rect.max_.x_ < rect.min_.x_ || node.rect.min_.x_ > rect.max_.x_ || node.rect.max_.y_ < rect.min_.y_ || node.rect.min_.y_ > rect.max_.y_)
+			{
+				continue;
+			}
+
+			if (node.child1 == NULL_NODE)
+			{
+				callback(index);
+			}
+			else
+			{
+				stack_.Push(node.child1);
+				stack_.Push(node.child2);
+			}
+		}
+	}
+}
\ No newline at end of file
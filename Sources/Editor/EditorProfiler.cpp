@@ -0,0 +1,144 @@
+#include "EditorProfiler.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Core/CoreEvents.h>
+
+using namespace Urho3D;
+
+static const unsigned FRAME_HISTORY_SIZE = 128;
+
+namespace Geode
+{
+	EditorProfiler::EditorProfiler(Context* context) : Object(context)
+	{
+		enabled_ = false;
+		numFrames_ = 0;
+		frameIndex_ = 0;
+		frameTimes_.Resize(FRAME_HISTORY_SIZE);
+
+		SubscribeToEvent(E_BEGINFRAME, GEODE_HANDLER(EditorProfiler, HandleBeginFrame));
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void EditorProfiler::SetEnabled(bool enabled)
+	{
+		if (enabled != enabled_)
+		{
+			enabled_ = enabled;
+			numFrames_ = 0;
+			blocks_.Clear();
+			frameTimer_.Reset();
+		}
+	}
+
+	bool EditorProfiler::IsEnabled() const
+	{
+		return enabled_;
+	}
+
+	unsigned EditorProfiler::GetNumFrames() const
+	{
+		return numFrames_;
+	}
+
+	float EditorProfiler::GetFrameTime(unsigned age) const
+	{
+		if (age >= numFrames_)
+		{
+			return 0.0f;
+		}
+
+		return frameTimes_[(frameIndex_ + FRAME_HISTORY_SIZE - 1 - age) % FRAME_HISTORY_SIZE];
+	}
+
+	float EditorProfiler::GetBlockTime(const String& name) const
+	{
+		auto blockIt = blocks_.Find(name);
+		return blockIt != blocks_.End() ? blockIt->second_.lastTime / 1000.0f : 0.0f;
+	}
+
+	unsigned EditorProfiler::GetBlockCount(const String& name) const
+	{
+		auto blockIt = blocks_.Find(name);
+		return blockIt != blocks_.End() ? blockIt->second_.lastCount : 0;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void EditorProfiler::AddBlockTime(const char* name, long long usec)
+	{
+		auto blockIt = blocks_.Find(StringHash(name));
+
+		if (blockIt == blocks_.End())
+		{
+			Block block;
+			block.time = 0;
+			block.count = 0;
+			block.lastTime = 0;
+			block.lastCount = 0;
+			blockIt = blocks_.Insert(MakePair(StringHash(name), block));
+		}
+
+		blockIt->second_.time += usec;
+		blockIt->second_.count++;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void EditorProfiler::HandleBeginFrame(StringHash, VariantMap&)
+	{
+		if (!enabled_)
+		{
+			return;
+		}
+
+		// Frame boundaries are taken at the same point, so the frame time includes rendering and vsync.
+		frameTimes_[frameIndex_] = frameTimer_.GetUSec(true) / 1000.0f;
+		frameIndex_ = (frameIndex_ + 1) % FRAME_HISTORY_SIZE;
+		numFrames_ = Min(numFrames_ + 1, FRAME_HISTORY_SIZE);
+
+		for (auto& block : blocks_)
+		{
+			block.second_.lastTime = block.second_.time;
+			block.second_.lastCount = block.second_.count;
+			block.second_.time = 0;
+			block.second_.count = 0;
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  PROFILE BLOCK
+	///------------------------------------------------------------------------------------------------
+
+	EditorProfileBlock::EditorProfileBlock(Context* context, const char* name)
+	{
+		auto profiler = context->GetSubsystem<EditorProfiler>();
+
+		profiler_ = profiler != nullptr && profiler->IsEnabled() ? profiler : nullptr;
+		recorder_ = TraceRecorder::GetActive();
+		name_ = name;
+		start_ = recorder_ != nullptr ? recorder_->GetTime() : 0;
+	}
+
+	EditorProfileBlock::~EditorProfileBlock()
+	{
+		if (profiler_ != nullptr)
+		{
+			profiler_->AddBlockTime(name_, timer_.GetUSec(false));
+		}
+
+		// Profiled blocks show up in captures too, their scopes need no separate trace.
+		if (recorder_ != nullptr)
+		{
+			recorder_->AddEvent(name_, "profile", start_, recorder_->GetTime() - start_);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**
+ * @file    EditorProfiler.h
+ * @ingroup Editor
+ * @brief   Per-frame timings of the editor subsystems.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Container/HashMap.h>
+
+/// Time the enclosing scope under the given block name, also traced while a capture is running. The enclosing class must be an Urho3D::Object.
+#define GEODE_PROFILE(name) Geode::EditorProfileBlock editorProfileBlock_(context_, name)
+
+namespace Geode
+{
+	class TraceRecorder;
+
+	class EditorProfiler : public Urho3D::Object
+	{
+		URHO3D_OBJECT(EditorProfiler, Urho3D::Object)
+
+		struct Block {
+			long long time;
+			unsigned count;
+			long long lastTime;
+			unsigned lastCount;
+		};
+
+	public:
+		/// Constructors.
+		explicit EditorProfiler(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetEnabled(bool enabled);
+		bool IsEnabled() const;
+		unsigned GetNumFrames() const;
+		float GetFrameTime(unsigned age = 0) const;
+		float GetBlockTime(const Urho3D::String& name) const;
+		unsigned GetBlockCount(const Urho3D::String& name) const;
+
+		/// Other methods.
+		void AddBlockTime(const char* name, long long usec);
+
+	private:
+		/// Event handlers.
+		void HandleBeginFrame(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+	private:
+		bool enabled_;
+		Urho3D::HiresTimer frameTimer_;
+		Urho3D::PODVector<float> frameTimes_;
+		unsigned numFrames_;
+		unsigned frameIndex_;
+		Urho3D::HashMap<Urho3D::StringHash, Block> blocks_;
+	};
+
+	class EditorProfileBlock
+	{
+	public:
+		/// Constructors.
+		EditorProfileBlock(Urho3D::Context* context, const char* name);
+		~EditorProfileBlock();
+
+	private:
+		Geode::EditorProfiler* profiler_;
+		Geode::TraceRecorder* recorder_;
+		const char* name_;
+		long long start_;
+		Urho3D::HiresTimer timer_;
+	};
+}
\ No newline at end of file
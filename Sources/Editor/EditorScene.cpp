@@ -1,22 +1,45 @@
 #include "EditorScene.h"
+#include "SceneLoader.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
 
 #include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/CoreEvents.h>
 #include <Urho3D/Core/Variant.h>
 #include <Urho3D/Scene/SceneEvents.h>
 #include <Urho3D/Resource/ResourceCache.h>
 #include <Urho3D/Resource/XMLFile.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/Log.h>
 #include <Urho3D/Graphics/Drawable.h>
 
 using namespace Urho3D;
 
+static const String CHUNK_DIRECTORY_SUFFIX = "_chunks/";
+static const String CHUNK_FILE_PREFIX = "Node";
+
 namespace Geode
 {
 	EditorScene::EditorScene(Context* context) : Scene(context)
 	{
-		selectedObject_ = nullptr;
-
-		SubscribeToEvent(this, E_NODEREMOVED, URHO3D_HANDLER(EditorScene, HandleSceneNodeRemoved));
-		SubscribeToEvent(this, E_COMPONENTREMOVED, URHO3D_HANDLER(EditorScene, HandleSceneComponentRemoved));
+		selectionChanged_ = false;
+		chunkedLayout_ = false;
+		manifestDirty_ = false;
+		playing_ = false;
+		playSnapshot_ = MakeShared<SceneSnapshot>(context_);
+		worldPartition_ = MakeShared<WorldPartition>(context_, this);
+		spatialIndex_ = MakeShared<EditorSpatialIndex>(context_, this);
+
+		SubscribeToEvent(this, E_NODEADDED, GEODE_HANDLER(EditorScene, HandleSceneNodeAdded));
+		SubscribeToEvent(this, E_NODEREMOVED, GEODE_HANDLER(EditorScene, HandleSceneNodeRemoved));
+		SubscribeToEvent(this, E_COMPONENTADDED, GEODE_HANDLER(EditorScene, HandleSceneComponentAdded));
+		SubscribeToEvent(this, E_COMPONENTREMOVED, GEODE_HANDLER(EditorScene, HandleSceneComponentRemoved));
+		SubscribeToEvent(E_UPDATE, GEODE_HANDLER(EditorScene, HandleUpdate));
+		SubscribeToEvent(E_POSTUPDATE, GEODE_HANDLER(EditorScene, HandlePostUpdate));
+
+		// Edit mode: physics, animations and logic components stay still, only the editor updates.
+		SetUpdateEnabled(false);
 
 		Load("Scenes/Room/scene.xml");
 	}
@@ -32,31 +55,65 @@ namespace Geode
 
 	void EditorScene::SetSelectedObject(Node* node)
 	{
-		if (node != selectedObject_)
+		if (selectedObjects_.Size() == 1 && selectedObjects_[0] == node)
 		{
-			selectedObject_ = node;
-
-			VariantMap sendEventData;
-			sendEventData[SelectedObjectChanged::P_OBJECT] = selectedObject_;
-			SendEvent(E_SELECTEDOBJECTCHANGED, sendEventData);
+			return;
 		}
+
+		ClearSelection();
+		AddSelectedObject(node);
 	}
 
 	void EditorScene::SetSelectedObject(Component* component)
 	{
-		if (component != selectedObject_)
+		if (selectedObjects_.Size() == 1 && selectedObjects_[0] == component)
 		{
-			selectedObject_ = component;
+			return;
+		}
 
-			VariantMap sendEventData;
-			sendEventData[SelectedObjectChanged::P_OBJECT] = selectedObject_;
-			SendEvent(E_SELECTEDOBJECTCHANGED, sendEventData);
+		ClearSelection();
+		AddSelectedObject(component);
+	}
+
+	void EditorScene::AddSelectedObject(Object* object)
+	{
+		if (!IsSelectable(object) || selectedSet_.Contains(object))
+		{
+			return;
+		}
+
+		selectedSet_.Insert(object);
+		selectedObjects_.Push(object);
+		selectionChanged_ = true;
+	}
+
+	void EditorScene::RemoveSelectedObject(Object* object)
+	{
+		if (!selectedSet_.Erase(object))
+		{
+			return;
+		}
+
+		selectedObjects_.Remove(object);
+		selectionChanged_ = true;
+	}
+
+	void EditorScene::ToggleSelectedObject(Object* object)
+	{
+		if (selectedSet_.Contains(object))
+		{
+			RemoveSelectedObject(object);
+		}
+		else
+		{
+			AddSelectedObject(object);
 		}
 	}
 
 	Object* EditorScene::GetSelectedObject()
 	{
-		return selectedObject_;
+		// The last selected object is the primary one, it drives gizmos and single-object views.
+		return selectedObjects_.Empty() ? nullptr : selectedObjects_.Back();
 	}
 
 	Node* EditorScene::GetSelectedNode()
@@ -83,38 +140,358 @@ namespace Geode
 		return static_cast<Component*>(selectedObject);
 	}
 
+	const PODVector<Object*>& EditorScene::GetSelectedObjects() const
+	{
+		return selectedObjects_;
+	}
+
+	PODVector<Node*> EditorScene::GetSelectedNodes(bool topMostOnly) const
+	{
+		PODVector<Node*> nodes;
+
+		for (auto object : selectedObjects_)
+		{
+			if (!object->IsInstanceOf<Node>())
+			{
+				continue;
+			}
+
+			auto node = static_cast<Node*>(object);
+			auto ancestorSelected = false;
+
+			// Descendants follow their selected ancestor, editing both would apply the transform twice.
+			for (auto parent = node->GetParent(); topMostOnly && parent != nullptr && !ancestorSelected; parent = parent->GetParent())
+			{
+				ancestorSelected = selectedSet_.Contains(parent);
+			}
+
+			if (!ancestorSelected)
+			{
+				nodes.Push(node);
+			}
+		}
+
+		return nodes;
+	}
+
+	unsigned EditorScene::GetNumSelectedObjects() const
+	{
+		return selectedObjects_.Size();
+	}
+
+	bool EditorScene::IsSelected(Object* object) const
+	{
+		return selectedSet_.Contains(object);
+	}
+
 	void EditorScene::ClearSelection()
 	{
-		if (selectedObject_ == nullptr)
+		if (selectedObjects_.Empty())
+		{
+			return;
+		}
+
+		selectedSet_.Clear();
+		selectedObjects_.Clear();
+		selectionChanged_ = true;
+	}
+
+	void EditorScene::DeselectSubtree(Node* node)
+	{
+		if (selectedObjects_.Empty())
 		{
 			return;
 		}
 
-		selectedObject_ = nullptr;
+		// Compact the ordered list in one pass, removing a large subtree stays linear.
+		unsigned count = 0;
+
+		for (auto object : selectedObjects_)
+		{
+			auto objectNode = object->IsInstanceOf<Component>() ? static_cast<Component*>(object)->GetNode() : static_cast<Node*>(object);
+
+			if (objectNode == node || (objectNode != nullptr && objectNode->IsChildOf(node)))
+			{
+				selectedSet_.Erase(object);
+				selectionChanged_ = true;
+			}
+			else
+			{
+				selectedObjects_[count++] = object;
+			}
+		}
+
+		selectedObjects_.Resize(count);
+	}
+
+	void EditorScene::SetChunkedLayout(bool chunkedLayout)
+	{
+		chunkedLayout_ = chunkedLayout;
+	}
+
+	bool EditorScene::GetChunkedLayout() const
+	{
+		return chunkedLayout_;
+	}
+
+	void EditorScene::SetPlaying(bool playing)
+	{
+		GEODE_TRACE("EditorScene::SetPlaying", "io");
+
+		if (playing == playing_)
+		{
+			return;
+		}
+
+		if (playing)
+		{
+			playSnapshot_->Capture(this);
+			playing_ = true;
+			SetUpdateEnabled(true);
+		}
+		else
+		{
+			// Node ids are kept by the snapshot, so chunk and cell bookkeeping still match the restored nodes.
+			SetUpdateEnabled(false);
+			RestoreSnapshot(playSnapshot_);
+			playSnapshot_->Clear();
+			playing_ = false;
+		}
 
 		VariantMap sendEventData;
-		sendEventData[SelectedObjectChanged::P_OBJECT] = selectedObject_;
-		SendEvent(E_SELECTEDOBJECTCHANGED, sendEventData);
+		sendEventData[ScenePlayingChanged::P_PLAYING] = playing_;
+		SendEvent(E_SCENEPLAYINGCHANGED, sendEventData);
+	}
+
+	bool EditorScene::IsPlaying() const
+	{
+		return playing_;
+	}
+
+	WorldPartition* EditorScene::GetWorldPartition() const
+	{
+		return worldPartition_;
+	}
+
+	EditorSpatialIndex* EditorScene::GetSpatialIndex() const
+	{
+		return spatialIndex_;
 	}
 
 	///------------------------------------------------------------------------------------------------
 	///  OTHER METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void EditorScene::Load(const String& filename)
+	bool EditorScene::Load(const String& filename)
 	{
+		GEODE_TRACE("EditorScene::Load", "io");
+
 		auto cache = GetSubsystem<ResourceCache>();
-		LoadXML(cache->GetResource<XMLFile>(filename)->GetRoot());
+		auto loader = MakeShared<SceneLoader>(context_);
+
+		// The preview snapshot belongs to the previous scene.
+		if (playing_)
+		{
+			playing_ = false;
+			playSnapshot_->Clear();
+			SetUpdateEnabled(false);
+
+			VariantMap sendEventData;
+			sendEventData[ScenePlayingChanged::P_PLAYING] = false;
+			SendEvent(E_SCENEPLAYINGCHANGED, sendEventData);
+		}
+
+		ClearSelection();
+		worldPartition_->Close();
 
+		// Per-node add/remove notifications are pointless while the whole scene is replaced, E_SCENELOADED follows.
+		SetBlockEvents(true);
+
+		auto success = false;
+		incompleteFilename_ = String::EMPTY;
+
+		if (GetExtension(filename) == ".xml")
+		{
+			// Chunk files are rewritten by incremental saves, so bypass the resource cache.
+			auto xmlFile = cache->GetTempResource<XMLFile>(filename);
+			success = loader->LoadXML(this, xmlFile);
+
+			chunkedLayout_ = xmlFile != nullptr && xmlFile->GetRoot().GetChild("chunk").NotNull();
+
+			// Partitioned scenes only hold the scene root here, cells are streamed in afterwards.
+			if (xmlFile != nullptr && xmlFile->GetRoot().GetChild("partition").NotNull())
+			{
+				worldPartition_->Open(cache->GetResourceFileName(filename), xmlFile->GetRoot());
+			}
+		}
+		else
+		{
+			auto file = cache->GetFile(filename);
+			success = file != nullptr && loader->LoadBinary(this, *file);
+			chunkedLayout_ = false;
+		}
+
+		// A partial load is no baseline: saving it must neither skip chunks nor prune the unreadable ones.
+		if (chunkedLayout_ && !success)
+		{
+			incompleteFilename_ = cache->GetResourceFileName(filename);
+			URHO3D_LOGERROR("Scene " + filename + " was only partially loaded, its chunk files will not be pruned");
+		}
+
+		ResetDirtyChunks(chunkedLayout_ && success ? cache->GetResourceFileName(filename) : String::EMPTY);
+		spatialIndex_->MarkDirty();
+
+		SetBlockEvents(false);
 		SendEvent(E_SCENELOADED);
+		return success;
 	}
 
-	void EditorScene::Save(const String& filename)
+	bool EditorScene::Save(const String& filename)
 	{
-		File file(context_, filename, FileMode::FILE_WRITE);
-		SaveXML(file);
+		GEODE_TRACE("EditorScene::Save", "io");
+
+		// Only the edited state is saved, never the simulated one.
+		SetPlaying(false);
+
+		auto success = false;
+
+		if (worldPartition_->IsEnabled())
+		{
+			success = worldPartition_->Save(filename);
+		}
+		else if (chunkedLayout_ && GetExtension(filename) == ".xml")
+		{
+			success = SaveChunked(filename);
+		}
+		else
+		{
+			File file(context_, filename, FileMode::FILE_WRITE);
+
+			if (file.IsOpen())
+			{
+				success = GetExtension(filename) == ".xml" ? SaveXML(file) : Scene::Save(file);
+			}
+
+			// Dirty chunks are kept on failure, the next save still writes them.
+			if (success)
+			{
+				ResetDirtyChunks(String::EMPTY);
+			}
+		}
+
+		if (!success)
+		{
+			URHO3D_LOGERROR("Failed to save scene " + filename);
+			return false;
+		}
 
 		SendEvent(E_SCENESAVED);
+		return true;
+	}
+
+	SceneSnapshot::Ptr EditorScene::CreateSnapshot()
+	{
+		auto snapshot = MakeShared<SceneSnapshot>(context_);
+		snapshot->Capture(this);
+		return snapshot;
+	}
+
+	bool EditorScene::RestoreSnapshot(SceneSnapshot* snapshot)
+	{
+		if (snapshot == nullptr || snapshot->GetScene() != this)
+		{
+			return false;
+		}
+
+		ClearSelection();
+
+		// Per-object notifications are pointless while the scene is reverted, E_SCENELOADED follows.
+		SetBlockEvents(true);
+		snapshot->Restore(this);
+		SetBlockEvents(false);
+
+		spatialIndex_->MarkDirty();
+
+		// Reverting edits is an edit too, play mode changes were never recorded.
+		if (!playing_)
+		{
+			manifestDirty_ = true;
+
+			for (auto& child : GetChildren())
+			{
+				dirtyChunks_.Insert(child->GetID());
+			}
+		}
+
+		SendEvent(E_SCENELOADED);
+		return true;
+	}
+
+	void EditorScene::MarkDirty(Serializable* serializable)
+	{
+		Node* node = nullptr;
+
+		if (serializable == nullptr)
+		{
+			return;
+		}
+
+		// Any edit may move or resize drawables, picking rects are rebuilt on the next query.
+		spatialIndex_->MarkDirty();
+
+		// Changes made while playing are thrown away with the preview.
+		if (playing_)
+		{
+			return;
+		}
+
+		if (serializable->IsInstanceOf<Node>())
+		{
+			node = static_cast<Node*>(serializable);
+		}
+		else if (serializable->IsInstanceOf<Component>())
+		{
+			node = static_cast<Component*>(serializable)->GetNode();
+		}
+
+		if (node == nullptr || node->IsTemporary())
+		{
+			return;
+		}
+
+		if (node == this)
+		{
+			manifestDirty_ = true;
+			return;
+		}
+
+		// Chunks are keyed by the top-level node owning the modified subtree.
+		while (node->GetParent() != nullptr && node->GetParent() != this)
+		{
+			node = node->GetParent();
+		}
+
+		if (node->GetParent() == this)
+		{
+			dirtyChunks_.Insert(node->GetID());
+			worldPartition_->MarkNodeDirty(node);
+		}
+	}
+
+	void EditorScene::SaveManifestXML(XMLElement& dest) const
+	{
+		// Scene attributes and components only, top-level nodes are stored elsewhere.
+		dest.SetUInt("id", GetID());
+		Animatable::SaveXML(dest);
+
+		for (auto& component : GetComponents())
+		{
+			if (!component->IsTemporary())
+			{
+				auto componentElement = dest.CreateChild("component");
+				component->SaveXML(componentElement);
+			}
+		}
 	}
 
 	Node* EditorScene::CreateNewNode(Node* parentNode)
@@ -154,18 +531,17 @@ namespace Geode
 
 	Node* EditorScene::GetNodeAt(Vector2 pos)
 	{
-		PODVector<Node*> nodes;
-		GetChildren(nodes, true);
+		return spatialIndex_->GetNodeAt(pos);
+	}
 
-		for (auto node : nodes)
-		{
-			if (GetNodeWorldRect(node).IsInside(pos))
-			{
-				return node;
-			}
-		}
+	Node* EditorScene::GetSelectedNodeAt(const Vector2& pos)
+	{
+		return spatialIndex_->GetNodeAt(pos, selectedSet_);
+	}
 
-		return nullptr;
+	void EditorScene::GetNodesInRect(PODVector<Node*>& dest, const Rect& rect)
+	{
+		spatialIndex_->GetNodesInRect(dest, rect);
 	}
 
 	BoundingBox EditorScene::GetNodeWorldBoundingBox(Node* node)
@@ -228,27 +604,179 @@ namespace Geode
 		return -1;
 	}
 
+	bool EditorScene::IsSelectable(Object* object) const
+	{
+		return object != nullptr && object != this && (object->IsInstanceOf<Node>() || object->IsInstanceOf<Component>());
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
+	void EditorScene::HandleSceneNodeAdded(StringHash, VariantMap& eventData)
+	{
+		auto node = static_cast<Node*>(eventData[NodeAdded::P_NODE].GetPtr());
+		auto parent = static_cast<Node*>(eventData[NodeAdded::P_PARENT].GetPtr());
+
+		if (parent == this && !playing_)
+		{
+			manifestDirty_ = true;
+		}
+
+		MarkDirty(node);
+	}
+
 	void EditorScene::HandleSceneNodeRemoved(StringHash, VariantMap& eventData)
 	{
-		auto node = eventData[NodeRemoved::P_NODE].GetPtr();
+		auto node = static_cast<Node*>(eventData[NodeRemoved::P_NODE].GetPtr());
+		auto parent = static_cast<Node*>(eventData[NodeRemoved::P_PARENT].GetPtr());
 
-		if (node == selectedObject_)
+		spatialIndex_->MarkDirty();
+
+		// Nodes destroyed while playing come back with the snapshot, chunks and cells keep them.
+		if (parent == this && !playing_)
+		{
+			manifestDirty_ = true;
+			dirtyChunks_.Erase(node->GetID());
+			worldPartition_->RemoveNode(node);
+		}
+		else if (parent != this)
 		{
-			ClearSelection();
+			MarkDirty(parent);
 		}
+
+		DeselectSubtree(node);
+	}
+
+	void EditorScene::HandleSceneComponentAdded(StringHash, VariantMap& eventData)
+	{
+		MarkDirty(static_cast<Node*>(eventData[ComponentAdded::P_NODE].GetPtr()));
 	}
 
 	void EditorScene::HandleSceneComponentRemoved(StringHash, VariantMap& eventData)
 	{
 		auto component = eventData[ComponentRemoved::P_COMPONENT].GetPtr();
 
-		if (component == selectedObject_)
+		spatialIndex_->MarkDirty();
+		MarkDirty(static_cast<Node*>(eventData[ComponentRemoved::P_NODE].GetPtr()));
+
+		RemoveSelectedObject(static_cast<Component*>(component));
+	}
+
+	void EditorScene::HandleUpdate(StringHash, VariantMap& eventData)
+	{
+		// The simulation moves nodes without telling anybody.
+		if (playing_)
+		{
+			spatialIndex_->MarkDirty();
+		}
+
+		VariantMap sendEventData;
+		sendEventData[EditorUpdate::P_TIMESTEP] = eventData[Update::P_TIMESTEP];
+		SendEvent(E_EDITORUPDATE, sendEventData);
+	}
+
+	void EditorScene::HandlePostUpdate(StringHash, VariantMap&)
+	{
+		// Selection edits are coalesced, listeners are notified at most once per frame.
+		if (!selectionChanged_)
 		{
-			ClearSelection();
+			return;
 		}
+
+		selectionChanged_ = false;
+
+		VariantMap sendEventData;
+		sendEventData[SelectedObjectChanged::P_OBJECT] = GetSelectedObject();
+		SendEvent(E_SELECTEDOBJECTCHANGED, sendEventData);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  CHUNKED LAYOUT
+	///------------------------------------------------------------------------------------------------
+
+	bool EditorScene::SaveChunked(const String& filename)
+	{
+		GEODE_TRACE("EditorScene::SaveChunked", "io");
+
+		auto fileSystem = GetSubsystem<FileSystem>();
+		auto chunkDirectory = GetFileName(filename) + CHUNK_DIRECTORY_SUFFIX;
+		auto chunkPath = GetPath(filename) + chunkDirectory;
+		auto fullSave = filename != chunkedFilename_;
+
+		fileSystem->CreateDir(chunkPath);
+
+		// The manifest holds the scene attributes, its components and the ordered list of chunks.
+		auto manifest = MakeShared<XMLFile>(context_);
+		auto root = manifest->CreateRoot("scene");
+		SaveManifestXML(root);
+
+		HashSet<String> chunkFileNames;
+		auto success = true;
+
+		for (auto& child : GetChildren())
+		{
+			if (child->IsTemporary())
+			{
+				continue;
+			}
+
+			auto chunkFileName = CHUNK_FILE_PREFIX + String(child->GetID()) + ".xml";
+			root.CreateChild("chunk").SetAttribute("file", chunkDirectory + chunkFileName);
+			chunkFileNames.Insert(chunkFileName);
+
+			if (!fullSave && !dirtyChunks_.Contains(child->GetID()))
+			{
+				continue;
+			}
+
+			auto chunk = MakeShared<XMLFile>(context_);
+			auto chunkRoot = chunk->CreateRoot("node");
+			child->SaveXML(chunkRoot);
+			success = chunk->SaveFile(chunkPath + chunkFileName) && success;
+		}
+
+		// Dirty chunks are kept and nothing is pruned, the next save retries what failed.
+		if (!success)
+		{
+			return false;
+		}
+
+		if (fullSave || manifestDirty_)
+		{
+			if (!manifest->SaveFile(filename))
+			{
+				return false;
+			}
+
+			// Chunks missing from a partial load are kept on disk, they were never seen rather than deleted.
+			if (filename == incompleteFilename_)
+			{
+				ResetDirtyChunks(filename);
+				return true;
+			}
+
+			// Drop chunks of top-level nodes which no longer exist.
+			Vector<String> existingFileNames;
+			fileSystem->ScanDir(existingFileNames, chunkPath, "*.xml", SCAN_FILES, false);
+
+			for (auto& existingFileName : existingFileNames)
+			{
+				if (!chunkFileNames.Contains(existingFileName))
+				{
+					fileSystem->Delete(chunkPath + existingFileName);
+				}
+			}
+		}
+
+		ResetDirtyChunks(filename);
+		return true;
+	}
+
+	void EditorScene::ResetDirtyChunks(const String& chunkedFilename)
+	{
+		chunkedFilename_ = chunkedFilename;
+		manifestDirty_ = false;
+		dirtyChunks_.Clear();
 	}
 }
@@ -11,10 +11,14 @@
 #pragma once
 
 #include "EditorSceneEvents.h"
+#include "WorldPartition.h"
+#include "EditorSpatialIndex.h"
+#include "SceneSnapshot.h"
 
 #include <Urho3D/Scene/Scene.h>
 #include <Urho3D/Scene/Node.h>
 #include <Urho3D/Scene/Component.h>
+#include <Urho3D/Container/HashSet.h>
 
 namespace Geode
 {
@@ -33,18 +37,38 @@ namespace Geode
 		/// Accessors & Mutators.
 		void SetSelectedObject(Urho3D::Node* node);
 		void SetSelectedObject(Urho3D::Component* component);
+		void AddSelectedObject(Urho3D::Object* object);
+		void RemoveSelectedObject(Urho3D::Object* object);
+		void ToggleSelectedObject(Urho3D::Object* object);
 		template<typename T> T* GetSelectedObjectAs();
 		Urho3D::Object* GetSelectedObject();
 		Urho3D::Node* GetSelectedNode();
 		Urho3D::Component* GetSelectedComponent();
+		const Urho3D::PODVector<Urho3D::Object*>& GetSelectedObjects() const;
+		Urho3D::PODVector<Urho3D::Node*> GetSelectedNodes(bool topMostOnly = false) const;
+		unsigned GetNumSelectedObjects() const;
+		bool IsSelected(Urho3D::Object* object) const;
 		void ClearSelection();
+		void DeselectSubtree(Urho3D::Node* node);
+		void SetChunkedLayout(bool chunkedLayout);
+		void SetPlaying(bool playing);
+		bool IsPlaying() const;
+		bool GetChunkedLayout() const;
+		Geode::WorldPartition* GetWorldPartition() const;
+		Geode::EditorSpatialIndex* GetSpatialIndex() const;
 
 		/// Other methods.
-		void Load(const Urho3D::String& filename);
-		void Save(const Urho3D::String& filename);
+		bool Load(const Urho3D::String& filename);
+		bool Save(const Urho3D::String& filename);
+		void MarkDirty(Urho3D::Serializable* serializable);
+		Geode::SceneSnapshot::Ptr CreateSnapshot();
+		bool RestoreSnapshot(Geode::SceneSnapshot* snapshot);
+		void SaveManifestXML(Urho3D::XMLElement& dest) const;
 		Urho3D::Node* CreateNewNode(Urho3D::Node* parentNode);
 		Urho3D::Node* GetNodeAt(Urho3D::Vector3 pos);
 		Urho3D::Node* GetNodeAt(Urho3D::Vector2 pos);
+		Urho3D::Node* GetSelectedNodeAt(const Urho3D::Vector2& pos);
+		void GetNodesInRect(Urho3D::PODVector<Urho3D::Node*>& dest, const Urho3D::Rect& rect);
 		Urho3D::BoundingBox GetNodeWorldBoundingBox(Urho3D::Node* node);
 		Urho3D::Rect GetNodeWorldRect(Urho3D::Node* node);
 		int IndexOfNode(Urho3D::Node* parentNode, Urho3D::Node* childNode);
@@ -52,11 +76,31 @@ namespace Geode
 
 	private:
 		/// Event handlers.
+		void HandleSceneNodeAdded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneNodeRemoved(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneComponentAdded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneComponentRemoved(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandlePostUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Other methods.
+		bool IsSelectable(Urho3D::Object* object) const;
+		bool SaveChunked(const Urho3D::String& filename);
+		void ResetDirtyChunks(const Urho3D::String& chunkedFilename);
 
 	private:
-		Urho3D::Object* selectedObject_;
+		Urho3D::HashSet<Urho3D::Object*> selectedSet_;
+		Urho3D::PODVector<Urho3D::Object*> selectedObjects_;
+		bool selectionChanged_;
+		bool chunkedLayout_;
+		Urho3D::String chunkedFilename_;
+		Urho3D::String incompleteFilename_;
+		bool manifestDirty_;
+		Urho3D::HashSet<unsigned> dirtyChunks_;
+		bool playing_;
+		Geode::SceneSnapshot::Ptr playSnapshot_;
+		Urho3D::SharedPtr<Geode::WorldPartition> worldPartition_;
+		Urho3D::SharedPtr<Geode::EditorSpatialIndex> spatialIndex_;
 	};
 }
 
@@ -7,8 +7,23 @@ URHO3D_EVENT(E_SELECTEDOBJECTCHANGED, SelectedObjectChanged)
     URHO3D_PARAM(P_OBJECT, Object);     // Urho3D::Object
 }
 
+URHO3D_EVENT(E_EDITORUPDATE, EditorUpdate)
+{
+    URHO3D_PARAM(P_TIMESTEP, TimeStep);     // float
+}
+
+URHO3D_EVENT(E_SCENEPLAYINGCHANGED, ScenePlayingChanged)
+{
+    URHO3D_PARAM(P_PLAYING, Playing);     // bool
+}
+
 URHO3D_EVENT(E_SCENELOADED, SceneLoaded)
 {}
 
 URHO3D_EVENT(E_SCENESAVED, SceneSaved)
-{}
\ No newline at end of file
+{}
+
+URHO3D_EVENT(E_SCENECELLSCHANGED, SceneCellsChanged)
+{
+    URHO3D_PARAM(P_UNLOADED, Unloaded);     // bool
+}
\ No newline at end of file
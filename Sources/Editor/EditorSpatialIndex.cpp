@@ -0,0 +1,227 @@
+#include "EditorSpatialIndex.h"
+#include "EditorScene.h"
+#include "GridCells.h"
+
+#include <Urho3D/Container/Sort.h>
+
+using namespace Urho3D;
+
+static const float DEFAULT_CELL_SIZE = 4.0f;
+static const int MAX_CELLS_PER_ENTRY = 256;
+
+namespace Geode
+{
+	EditorSpatialIndex::EditorSpatialIndex(Context* context, EditorScene* editorScene) : Object(context)
+	{
+		editorScene_ = editorScene;
+		cellSize_ = DEFAULT_CELL_SIZE;
+		dirty_ = true;
+		visitStamp_ = 0;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void EditorSpatialIndex::SetCellSize(float cellSize)
+	{
+		if (cellSize > 0.0f && cellSize != cellSize_)
+		{
+			cellSize_ = cellSize;
+			dirty_ = true;
+		}
+	}
+
+	float EditorSpatialIndex::GetCellSize() const
+	{
+		return cellSize_;
+	}
+
+	bool EditorSpatialIndex::IsDirty() const
+	{
+		return dirty_;
+	}
+
+	unsigned EditorSpatialIndex::GetNumEntries()
+	{
+		Rebuild();
+		return entries_.Size();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void EditorSpatialIndex::MarkDirty()
+	{
+		dirty_ = true;
+	}
+
+	Node* EditorSpatialIndex::GetNodeAt(const Vector2& position)
+	{
+		auto index = FindEntryAt(position, nullptr);
+		return index == M_MAX_UNSIGNED ? nullptr : entries_[index].node;
+	}
+
+	Node* EditorSpatialIndex::GetNodeAt(const Vector2& position, const HashSet<Object*>& candidates)
+	{
+		if (candidates.Empty())
+		{
+			return nullptr;
+		}
+
+		auto index = FindEntryAt(position, &candidates);
+		return index == M_MAX_UNSIGNED ? nullptr : entries_[index].node;
+	}
+
+	void EditorSpatialIndex::GetNodesInRect(PODVector<Node*>& dest, const Rect& rect)
+	{
+		Rebuild();
+
+		dest.Clear();
+
+		if (!rect.Defined())
+		{
+			return;
+		}
+
+		// Entries spanning several cells are visited once per query thanks to the stamps.
+		if (++visitStamp_ == 0)
+		{
+			for (auto& stamp : visitStamps_)
+			{
+				stamp = 0;
+			}
+
+			visitStamp_ = 1;
+		}
+
+		PODVector<unsigned> hits;
+
+		GridCells::Visit(cells_, GetCellCoords(rect.min_), GetCellCoords(rect.max_), [&](const PODVector<unsigned>& cell)
+		{
+			for (auto index : cell)
+			{
+				if (visitStamps_[index] != visitStamp_)
+				{
+					visitStamps_[index] = visitStamp_;
+
+					if (rect.IsInside(entries_[index].rect) != OUTSIDE)
+					{
+						hits.Push(index);
+					}
+				}
+			}
+		});
+
+		for (auto index : oversizedEntries_)
+		{
+			if (rect.IsInside(entries_[index].rect) != OUTSIDE)
+			{
+				hits.Push(index);
+			}
+		}
+
+		Sort(hits.Begin(), hits.End());
+
+		for (auto index : hits)
+		{
+			dest.Push(entries_[index].node);
+		}
+	}
+
+	IntVector2 EditorSpatialIndex::GetCellCoords(const Vector2& position) const
+	{
+		return IntVector2(FloorToInt(position.x_ / cellSize_), FloorToInt(position.y_ / cellSize_));
+	}
+
+	unsigned EditorSpatialIndex::FindEntryAt(const Vector2& position, const HashSet<Object*>* candidates)
+	{
+		Rebuild();
+
+		// Entries are stored in scene order, the lowest index wins like a linear scan of the scene would.
+		auto best = M_MAX_UNSIGNED;
+		auto cellIt = cells_.Find(GetCellCoords(position));
+
+		if (cellIt != cells_.End())
+		{
+			for (auto index : cellIt->second_)
+			{
+				if (index < best && entries_[index].rect.IsInside(position) != OUTSIDE && (candidates == nullptr || candidates->Contains(entries_[index].node)))
+				{
+					best = index;
+				}
+			}
+		}
+
+		for (auto index : oversizedEntries_)
+		{
+			if (index < best && entries_[index].rect.IsInside(position) != OUTSIDE && (candidates == nullptr || candidates->Contains(entries_[index].node)))
+			{
+				best = index;
+			}
+		}
+
+		return best;
+	}
+
+	void EditorSpatialIndex::Rebuild()
+	{
+		if (!dirty_)
+		{
+			return;
+		}
+
+		entries_.Clear();
+		cells_.Clear();
+		oversizedEntries_.Clear();
+
+		PODVector<Node*> nodes;
+		editorScene_->GetChildren(nodes, true);
+
+		for (auto node : nodes)
+		{
+			auto bb = editorScene_->GetNodeWorldBoundingBox(node);
+
+			// Nodes without drawables can't be picked.
+			if (!bb.Defined())
+			{
+				continue;
+			}
+
+			Entry entry;
+			entry.node = node;
+			entry.rect = Rect(bb.min_.x_, bb.min_.y_, bb.max_.x_, bb.max_.y_);
+
+			auto index = entries_.Size();
+			auto minCoords = GetCellCoords(entry.rect.min_);
+			auto maxCoords = GetCellCoords(entry.rect.max_);
+			entries_.Push(entry);
+
+			// Huge nodes (backgrounds, tilemaps) would flood the grid, they are tested on every query instead.
+			if ((maxCoords.x_ - minCoords.x_ + 1) * (maxCoords.y_ - minCoords.y_ + 1) > MAX_CELLS_PER_ENTRY)
+			{
+				oversizedEntries_.Push(index);
+				continue;
+			}
+
+			for (auto y = minCoords.y_; y <= maxCoords.y_; y++)
+			{
+				for (auto x = minCoords.x_; x <= maxCoords.x_; x++)
+				{
+					cells_[IntVector2(x, y)].Push(index);
+				}
+			}
+		}
+
+		visitStamps_.Resize(entries_.Size());
+
+		for (auto& stamp : visitStamps_)
+		{
+			stamp = 0;
+		}
+
+		visitStamp_ = 0;
+		dirty_ = false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+/**
+ * @file    EditorSpatialIndex.h
+ * @ingroup Editor
+ * @brief   Uniform grid over node world rects, used for picking and region queries.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Container/HashSet.h>
+#include <Urho3D/Scene/Node.h>
+#include <Urho3D/Math/Rect.h>
+#include <Urho3D/Math/Vector2.h>
+
+namespace Geode
+{
+	class EditorScene;
+
+	class EditorSpatialIndex : public Urho3D::Object
+	{
+		URHO3D_OBJECT(EditorSpatialIndex, Urho3D::Object)
+
+		struct Entry {
+			Urho3D::Node* node;
+			Urho3D::Rect rect;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<EditorSpatialIndex>;
+
+	public:
+		/// Constructors.
+		explicit EditorSpatialIndex(Urho3D::Context* context, Geode::EditorScene* editorScene);
+
+		/// Accessors & Mutators.
+		void SetCellSize(float cellSize);
+		float GetCellSize() const;
+		bool IsDirty() const;
+		unsigned GetNumEntries();
+
+		/// Other methods.
+		void MarkDirty();
+		Urho3D::Node* GetNodeAt(const Urho3D::Vector2& position);
+		Urho3D::Node* GetNodeAt(const Urho3D::Vector2& position, const Urho3D::HashSet<Urho3D::Object*>& candidates);
+		void GetNodesInRect(Urho3D::PODVector<Urho3D::Node*>& dest, const Urho3D::Rect& rect);
+
+	private:
+		/// Other methods.
+		Urho3D::IntVector2 GetCellCoords(const Urho3D::Vector2& position) const;
+		unsigned FindEntryAt(const Urho3D::Vector2& position, const Urho3D::HashSet<Urho3D::Object*>* candidates);
+		void Rebuild();
+
+	private:
+		Geode::EditorScene* editorScene_;
+		float cellSize_;
+		bool dirty_;
+		Urho3D::Vector<Entry> entries_;
+		Urho3D::HashMap<Urho3D::IntVector2, Urho3D::PODVector<unsigned>> cells_;
+		Urho3D::PODVector<unsigned> oversizedEntries_;
+		Urho3D::PODVector<unsigned> visitStamps_;
+		unsigned visitStamp_;
+	};
+}
\ No newline at end of file
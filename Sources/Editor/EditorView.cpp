@@ -5,42 +5,65 @@
 #include "RotateTool.h"
 #include "ScaleTool.h"
 #include "CollisionPolygon2DTool.h"
+#include "CollisionChain2DTool.h"
+#include "CollisionGenerator.h"
+#include "BodyConsolidator.h"
 #include "CollisionBox2DTool.h"
 #include "CollisionCircle2DTool.h"
+#include "IdleMonitor.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/UI/UIEvents.h>
 #include <Urho3D/Engine/Engine.h>
+#include <Urho3D/IO/FileSystem.h>
 
 using namespace Urho3D;
 
 static const unsigned int HISTORY_LIMIT = 4;
+static const unsigned int TRACE_NUM_FRAMES = 300;
 
 static const String FILE_MENU_TEXT = "File";
 static const String FILE_MENU_OPEN_TEXT = "Open Scene";
 static const String FILE_MENU_SAVE_TEXT = "Save Scene";
+static const String FILE_MENU_CHUNKED_LAYOUT_ENABLED_TEXT = "Enabled Chunked Scene Layout";
+static const String FILE_MENU_WORLD_PARTITION_ENABLED_TEXT = "Enabled World Partition";
 static const String FILE_MENU_QUIT_TEXT = "Quit";
 
 static const String EDIT_MENU_TEXT = "Edit";
 static const String EDIT_MENU_UNDO_TEXT = "Undo";
 static const String EDIT_MENU_DELETE_TEXT = "Delete";
 static const String EDIT_MENU_UNSELECT_TEXT = "Unselect";
+static const String EDIT_MENU_PLAY_TEXT = "Play Scene";
 static const String EDIT_MENU_NEW_NODE_TEXT = "New Node";
 static const String EDIT_MENU_CREATE_STATICSPRITE_TEXT = "Create StaticSprite2D";
 static const String EDIT_MENU_CREATE_RIGIDBODY2D_TEXT = "Create RigidBody2D";
 static const String EDIT_MENU_CREATE_COLLISIONBOX2D_TEXT = "Create CollisionBox2D";
 static const String EDIT_MENU_CREATE_COLLISIONPOLYGON2D_TEXT = "Create CollisionPolygon2D";
+static const String EDIT_MENU_CREATE_COLLISIONCHAIN2D_TEXT = "Create CollisionChain2D";
 static const String EDIT_MENU_CREATE_COLLISIONCIRCLE2D_TEXT = "Create CollisionCircle2D";
+static const String EDIT_MENU_GENERATE_COLLISIONPOLYGON2D_TEXT = "Generate Collision From Sprite";
+static const String EDIT_MENU_GENERATE_SCENE_COLLISION_TEXT = "Generate Collision For Scene";
+static const String EDIT_MENU_MERGE_STATIC_COLLIDERS_TEXT = "Merge Static Colliders";
+static const String EDIT_MENU_MERGE_STATIC_COLLIDERS_CHAINS_TEXT = "Merge Static Colliders Into Chains";
+static const String EDIT_MENU_CONSOLIDATE_STATIC_BODIES_TEXT = "Consolidate Static Bodies";
 
 static const String VIEW_MENU_TEXT = "View";
 static const String VIEW_MENU_ATTRIBUTE_WINDOW_TEXT = "Attribute Window";
 static const String VIEW_MENU_HIERARCHY_WINDOW_TEXT = "Hierarchy Window";
+static const String VIEW_MENU_EVENT_PROFILER_WINDOW_TEXT = "Event Profiler Window";
+static const String VIEW_MENU_COLLISION_ANALYSIS_WINDOW_TEXT = "Collision Analysis Window";
+static const String VIEW_MENU_RECORD_TRACE_TEXT = "Record Frame Trace";
 static const String VIEW_MENU_CLOSE_ALL_WINDOW_TEXT = "Close All Window";
 static const String VIEW_MENU_OPEN_ALL_WINDOW_TEXT = "Open All Window";
 static const String VIEW_MENU_RESET_WINDOW_LAYOUT_TEXT = "Reset Window Layout";
 static const String VIEW_MENU_DEBUG_GEOMETRY_ENABLED_TEXT = "Enabled Debug Geometry";
 static const String VIEW_MENU_NODE_POSITION_GIZMO_ENABLED_TEXT = "Enabled Node Position Gizmo";
 static const String VIEW_MENU_GRID_ENABLED_TEXT = "Enabled Grid";
+static const String VIEW_MENU_PERFORMANCE_HUD_ENABLED_TEXT = "Enabled Performance HUD";
+static const String VIEW_MENU_INPUT_COALESCING_ENABLED_TEXT = "Enabled Input Coalescing";
+static const String VIEW_MENU_IDLE_THROTTLING_ENABLED_TEXT = "Enabled Idle Throttling";
 
 namespace Geode
 {
@@ -78,28 +101,41 @@ namespace Geode
 		// ----------------------------------------------------------------------------------------------------------------
 		attributeWindowView_ = MakeShared<AttributeWindowView>(context_, commandHistory_, editorScene_);
 
+		// Init event profiler window view.
+		// ----------------------------------------------------------------------------------------------------------------
+		eventProfilerWindowView_ = MakeShared<EventProfilerWindowView>(context_);
+
 		// Init scene view.
 		// ----------------------------------------------------------------------------------------------------------------
 		sceneView_ = MakeShared<SceneView>(context_, middleBlock_, editorScene_);
 
+		// Init collision analysis window view.
+		// ----------------------------------------------------------------------------------------------------------------
+		collisionAnalysisWindowView_ = MakeShared<CollisionAnalysisWindowView>(context_, sceneView_);
+
 		// Init panel view.
 		// ----------------------------------------------------------------------------------------------------------------
 		panelView_ = MakeShared<PanelView>(context_, middleBlock_);
 		panelView_->RegisterWindowView(hierarchyWindowView_);
 		panelView_->RegisterWindowView(attributeWindowView_);
+		panelView_->RegisterWindowView(eventProfilerWindowView_);
+		panelView_->RegisterWindowView(collisionAnalysisWindowView_);
 		panelView_->AddTab(hierarchyWindowView_, true);
 		panelView_->AddTab(attributeWindowView_);
+		panelView_->AddTab(eventProfilerWindowView_);
+		panelView_->AddTab(collisionAnalysisWindowView_);
 
 		middleBlock_->UpdateLayout();
 
 		// Init tools view.
 		// ----------------------------------------------------------------------------------------------------------------
-		toolsView_ = MakeShared<ToolsView>(context_, topBlock_);
+		toolsView_ = MakeShared<ToolsView>(context_, topBlock_, sceneView_);
 		toolsView_->AddTool(MakeShared<MoveTool>(context_, commandHistory_, sceneView_));
 		toolsView_->AddTool(MakeShared<ScaleTool>(context_, commandHistory_, sceneView_));
 		toolsView_->AddTool(MakeShared<RotateTool>(context_, commandHistory_, sceneView_));
 
 		toolsView_->AddTool(MakeShared<CollisionPolygon2DTool>(context_, commandHistory_, sceneView_));
+		toolsView_->AddTool(MakeShared<CollisionChain2DTool>(context_, commandHistory_, sceneView_));
 		toolsView_->AddTool(MakeShared<CollisionBox2DTool>(context_, commandHistory_, sceneView_));
 		toolsView_->AddTool(MakeShared<CollisionCircle2DTool>(context_, commandHistory_, sceneView_));
 
@@ -108,57 +144,94 @@ namespace Geode
 		fileMenu_ = menuBar_->AddMenu(FILE_MENU_TEXT);
 		fileMenuOpenButton_ = fileMenu_->AddButton(FILE_MENU_OPEN_TEXT);
 		fileMenuSaveButton_ = fileMenu_->AddButton(FILE_MENU_SAVE_TEXT);
+		fileMenuChunkedLayoutEnabledCheckBox_ = fileMenu_->AddToggle(FILE_MENU_CHUNKED_LAYOUT_ENABLED_TEXT);
+		fileMenuWorldPartitionEnabledCheckBox_ = fileMenu_->AddToggle(FILE_MENU_WORLD_PARTITION_ENABLED_TEXT);
 		fileMenuQuitButton_ = fileMenu_->AddButton(FILE_MENU_QUIT_TEXT);
 
 		editMenu_ = menuBar_->AddMenu(EDIT_MENU_TEXT);
 		editMenuUndoButton_ = editMenu_->AddButton(EDIT_MENU_UNDO_TEXT);
 		editMenuDeleteButton_ = editMenu_->AddButton(EDIT_MENU_DELETE_TEXT);
 		editMenuUnselectButton_ = editMenu_->AddButton(EDIT_MENU_UNSELECT_TEXT);
+		editMenuPlayCheckBox_ = editMenu_->AddToggle(EDIT_MENU_PLAY_TEXT);
 		editMenuNewNodeButton_ = editMenu_->AddButton(EDIT_MENU_NEW_NODE_TEXT);
 		editMenuCreateStaticSprite2DButton_ = editMenu_->AddButton(EDIT_MENU_CREATE_STATICSPRITE_TEXT);
 		editMenuCreateRigidBody2DButton_ = editMenu_->AddButton(EDIT_MENU_CREATE_RIGIDBODY2D_TEXT);
 		editMenuCreateCollisionBox2DButton_ = editMenu_->AddButton(EDIT_MENU_CREATE_COLLISIONBOX2D_TEXT);
 		editMenuCreateCollisionPolygon2DButton_ = editMenu_->AddButton(EDIT_MENU_CREATE_COLLISIONPOLYGON2D_TEXT);
+		editMenuCreateCollisionChain2DButton_ = editMenu_->AddButton(EDIT_MENU_CREATE_COLLISIONCHAIN2D_TEXT);
 		editMenuCreateCollisionCircle2DButton_ = editMenu_->AddButton(EDIT_MENU_CREATE_COLLISIONCIRCLE2D_TEXT);
+		editMenuGenerateCollisionPolygon2DButton_ = editMenu_->AddButton(EDIT_MENU_GENERATE_COLLISIONPOLYGON2D_TEXT);
+		editMenuGenerateSceneCollisionButton_ = editMenu_->AddButton(EDIT_MENU_GENERATE_SCENE_COLLISION_TEXT);
+		editMenuMergeStaticCollidersButton_ = editMenu_->AddButton(EDIT_MENU_MERGE_STATIC_COLLIDERS_TEXT);
+		editMenuMergeStaticCollidersChainsButton_ = editMenu_->AddButton(EDIT_MENU_MERGE_STATIC_COLLIDERS_CHAINS_TEXT);
+		editMenuConsolidateStaticBodiesButton_ = editMenu_->AddButton(EDIT_MENU_CONSOLIDATE_STATIC_BODIES_TEXT);
 
 		viewMenu_ = menuBar_->AddMenu(VIEW_MENU_TEXT);
 		viewMenuAttributeWindowButton_ = viewMenu_->AddButton(VIEW_MENU_ATTRIBUTE_WINDOW_TEXT);
 		viewMenuHierarchyWindowButton_ = viewMenu_->AddButton(VIEW_MENU_HIERARCHY_WINDOW_TEXT);
+		viewMenuEventProfilerWindowButton_ = viewMenu_->AddButton(VIEW_MENU_EVENT_PROFILER_WINDOW_TEXT);
+		viewMenuCollisionAnalysisWindowButton_ = viewMenu_->AddButton(VIEW_MENU_COLLISION_ANALYSIS_WINDOW_TEXT);
+		viewMenuRecordTraceButton_ = viewMenu_->AddButton(VIEW_MENU_RECORD_TRACE_TEXT);
 		viewMenuCloseAllWindowButton_ = viewMenu_->AddButton(VIEW_MENU_CLOSE_ALL_WINDOW_TEXT);
 		viewMenuOpenAllWindowButton_ = viewMenu_->AddButton(VIEW_MENU_OPEN_ALL_WINDOW_TEXT);
 		viewMenuResetWindowLayoutButton_ = viewMenu_->AddButton(VIEW_MENU_RESET_WINDOW_LAYOUT_TEXT);
 		viewMenuDebugGeometryEnabledCheckBox_ = viewMenu_->AddToggle(VIEW_MENU_DEBUG_GEOMETRY_ENABLED_TEXT);
 		viewMenuNodePositionGizmoEnabledCheckBox_ = viewMenu_->AddToggle(VIEW_MENU_NODE_POSITION_GIZMO_ENABLED_TEXT);
 		viewMenuGridEnabledCheckBox_ = viewMenu_->AddToggle(VIEW_MENU_GRID_ENABLED_TEXT);
+		viewMenuPerformanceHudEnabledCheckBox_ = viewMenu_->AddToggle(VIEW_MENU_PERFORMANCE_HUD_ENABLED_TEXT);
+		viewMenuInputCoalescingEnabledCheckBox_ = viewMenu_->AddToggle(VIEW_MENU_INPUT_COALESCING_ENABLED_TEXT);
+		viewMenuIdleThrottlingEnabledCheckBox_ = viewMenu_->AddToggle(VIEW_MENU_IDLE_THROTTLING_ENABLED_TEXT);
 
 		// Synchronize menu bar.
 		// ----------------------------------------------------------------------------------------------------------------
+		fileMenuChunkedLayoutEnabledCheckBox_->SetChecked(editorScene_->GetChunkedLayout());
+		fileMenuWorldPartitionEnabledCheckBox_->SetChecked(editorScene_->GetWorldPartition()->IsEnabled());
 		viewMenuDebugGeometryEnabledCheckBox_->SetChecked(sceneView_->GetDebugGeometryEnabled());
 		viewMenuNodePositionGizmoEnabledCheckBox_->SetChecked(sceneView_->GetNodePositionGizmoEnabled());
 		viewMenuGridEnabledCheckBox_->SetChecked(sceneView_->GetGridEnabled());
+		viewMenuPerformanceHudEnabledCheckBox_->SetChecked(sceneView_->GetPerformanceHudEnabled());
+		viewMenuInputCoalescingEnabledCheckBox_->SetChecked(sceneView_->GetInputCoalescingEnabled());
+		viewMenuIdleThrottlingEnabledCheckBox_->SetChecked(GetSubsystem<IdleMonitor>() != nullptr && GetSubsystem<IdleMonitor>()->IsEnabled());
 
 		// Init all events.
 		// ----------------------------------------------------------------------------------------------------------------
-		SubscribeToEvent(fileMenuOpenButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleFileMenuOpenReleased));
-		SubscribeToEvent(fileMenuSaveButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleFileMenuSaveReleased));
-		SubscribeToEvent(fileMenuQuitButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleFileMenuQuitReleased));
-		SubscribeToEvent(editMenuUndoButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuUndoReleased));
-		SubscribeToEvent(editMenuDeleteButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuDeleteReleased));
-		SubscribeToEvent(editMenuUnselectButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuUnselectReleased));
-		SubscribeToEvent(editMenuNewNodeButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuCreateNewNodeReleased));
-		SubscribeToEvent(editMenuCreateStaticSprite2DButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuCreateStaticSprite2DReleased));
-		SubscribeToEvent(editMenuCreateRigidBody2DButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuCreateRigidBody2DReleased));
-		SubscribeToEvent(editMenuCreateCollisionBox2DButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuCreateCollisionBox2DReleased));
-		SubscribeToEvent(editMenuCreateCollisionPolygon2DButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuCreateCollisionPolygon2DReleased));
-		SubscribeToEvent(editMenuCreateCollisionCircle2DButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleEditMenuCreateCollisionCircle2DReleased));
-		SubscribeToEvent(viewMenuAttributeWindowButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleViewMenuAttributeWindowReleased));
-		SubscribeToEvent(viewMenuHierarchyWindowButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleViewMenuHierarchyWindowReleased));
-		SubscribeToEvent(viewMenuCloseAllWindowButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleViewMenuCloseAllWindowReleased));
-		SubscribeToEvent(viewMenuOpenAllWindowButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleViewMenuOpenAllWindowReleased));
-		SubscribeToEvent(viewMenuResetWindowLayoutButton_, E_RELEASED, URHO3D_HANDLER(EditorView, HandleViewMenuResetWindowLayoutReleased));
-		SubscribeToEvent(viewMenuDebugGeometryEnabledCheckBox_, E_TOGGLED, URHO3D_HANDLER(EditorView, HandleViewMenuDebugGeometryEnabledToggled));
-		SubscribeToEvent(viewMenuNodePositionGizmoEnabledCheckBox_, E_TOGGLED, URHO3D_HANDLER(EditorView, HandleViewMenuNodePositionGizmoEnabledToggled));
-		SubscribeToEvent(viewMenuGridEnabledCheckBox_, E_TOGGLED, URHO3D_HANDLER(EditorView, HandleViewMenuGridEnabledToggled));
+		SubscribeToEvent(fileMenuOpenButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleFileMenuOpenReleased));
+		SubscribeToEvent(fileMenuSaveButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleFileMenuSaveReleased));
+		SubscribeToEvent(fileMenuChunkedLayoutEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleFileMenuChunkedLayoutEnabledToggled));
+		SubscribeToEvent(fileMenuWorldPartitionEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleFileMenuWorldPartitionEnabledToggled));
+		SubscribeToEvent(fileMenuQuitButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleFileMenuQuitReleased));
+		SubscribeToEvent(editMenuUndoButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuUndoReleased));
+		SubscribeToEvent(editMenuDeleteButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuDeleteReleased));
+		SubscribeToEvent(editMenuUnselectButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuUnselectReleased));
+		SubscribeToEvent(editMenuPlayCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleEditMenuPlayToggled));
+		SubscribeToEvent(editMenuNewNodeButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateNewNodeReleased));
+		SubscribeToEvent(editMenuCreateStaticSprite2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateStaticSprite2DReleased));
+		SubscribeToEvent(editMenuCreateRigidBody2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateRigidBody2DReleased));
+		SubscribeToEvent(editMenuCreateCollisionBox2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateCollisionBox2DReleased));
+		SubscribeToEvent(editMenuCreateCollisionPolygon2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateCollisionPolygon2DReleased));
+		SubscribeToEvent(editMenuCreateCollisionChain2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateCollisionChain2DReleased));
+		SubscribeToEvent(editMenuCreateCollisionCircle2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuCreateCollisionCircle2DReleased));
+		SubscribeToEvent(editMenuGenerateCollisionPolygon2DButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuGenerateCollisionPolygon2DReleased));
+		SubscribeToEvent(editMenuGenerateSceneCollisionButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuGenerateSceneCollisionReleased));
+		SubscribeToEvent(editMenuMergeStaticCollidersButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuMergeStaticCollidersReleased));
+		SubscribeToEvent(editMenuMergeStaticCollidersChainsButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuMergeStaticCollidersChainsReleased));
+		SubscribeToEvent(editMenuConsolidateStaticBodiesButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleEditMenuConsolidateStaticBodiesReleased));
+		SubscribeToEvent(viewMenuAttributeWindowButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuAttributeWindowReleased));
+		SubscribeToEvent(viewMenuHierarchyWindowButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuHierarchyWindowReleased));
+		SubscribeToEvent(viewMenuEventProfilerWindowButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuEventProfilerWindowReleased));
+		SubscribeToEvent(viewMenuCollisionAnalysisWindowButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuCollisionAnalysisWindowReleased));
+		SubscribeToEvent(viewMenuRecordTraceButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuRecordTraceReleased));
+		SubscribeToEvent(viewMenuCloseAllWindowButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuCloseAllWindowReleased));
+		SubscribeToEvent(viewMenuOpenAllWindowButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuOpenAllWindowReleased));
+		SubscribeToEvent(viewMenuResetWindowLayoutButton_, E_RELEASED, GEODE_HANDLER(EditorView, HandleViewMenuResetWindowLayoutReleased));
+		SubscribeToEvent(viewMenuDebugGeometryEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleViewMenuDebugGeometryEnabledToggled));
+		SubscribeToEvent(viewMenuNodePositionGizmoEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleViewMenuNodePositionGizmoEnabledToggled));
+		SubscribeToEvent(viewMenuGridEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleViewMenuGridEnabledToggled));
+		SubscribeToEvent(viewMenuPerformanceHudEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleViewMenuPerformanceHudEnabledToggled));
+		SubscribeToEvent(viewMenuInputCoalescingEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleViewMenuInputCoalescingEnabledToggled));
+		SubscribeToEvent(viewMenuIdleThrottlingEnabledCheckBox_, E_TOGGLED, GEODE_HANDLER(EditorView, HandleViewMenuIdleThrottlingEnabledToggled));
+		SubscribeToEvent(editorScene_, E_SCENELOADED, GEODE_HANDLER(EditorView, HandleSceneLoaded));
+		SubscribeToEvent(editorScene_, E_SCENEPLAYINGCHANGED, GEODE_HANDLER(EditorView, HandleScenePlayingChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -175,6 +248,16 @@ namespace Geode
 		CreateSaveSceneFileSelector();
 	}
 
+	void EditorView::HandleFileMenuChunkedLayoutEnabledToggled(StringHash, VariantMap& eventData)
+	{
+		editorScene_->SetChunkedLayout(eventData[Toggled::P_STATE].GetBool());
+	}
+
+	void EditorView::HandleFileMenuWorldPartitionEnabledToggled(StringHash, VariantMap& eventData)
+	{
+		editorScene_->GetWorldPartition()->SetEnabled(eventData[Toggled::P_STATE].GetBool());
+	}
+
 	void EditorView::HandleFileMenuQuitReleased(StringHash, VariantMap&)
 	{
 		GetSubsystem<Engine>()->Exit();
@@ -190,6 +273,11 @@ namespace Geode
 		CommandInvoker(MakeShared<DeleteCommand>(editorScene_), commandHistory_).Exec();
 	}
 
+	void EditorView::HandleEditMenuPlayToggled(StringHash, VariantMap& eventData)
+	{
+		editorScene_->SetPlaying(eventData[Toggled::P_STATE].GetBool());
+	}
+
 	void EditorView::HandleEditMenuUnselectReleased(StringHash, VariantMap&)
 	{
 		CommandInvoker(MakeShared<UnselectCommand>(editorScene_), commandHistory_).Exec();
@@ -220,11 +308,41 @@ namespace Geode
 		CommandInvoker(MakeShared<CreateCollisionPolygon2DCommand>(editorScene_), commandHistory_).Exec();
 	}
 
+	void EditorView::HandleEditMenuCreateCollisionChain2DReleased(StringHash, VariantMap&)
+	{
+		CommandInvoker(MakeShared<CreateCollisionChain2DCommand>(editorScene_), commandHistory_).Exec();
+	}
+
 	void EditorView::HandleEditMenuCreateCollisionCircle2DReleased(StringHash, VariantMap&)
 	{
 		CommandInvoker(MakeShared<CreateCollisionCircle2DCommand>(editorScene_), commandHistory_).Exec();
 	}
 
+	void EditorView::HandleEditMenuGenerateCollisionPolygon2DReleased(StringHash, VariantMap&)
+	{
+		CommandInvoker(MakeShared<GenerateCollisionPolygon2DCommand>(editorScene_), commandHistory_).Exec();
+	}
+
+	void EditorView::HandleEditMenuGenerateSceneCollisionReleased(StringHash, VariantMap&)
+	{
+		CommandInvoker(MakeShared<CollisionGenerator>(context_)->Generate(editorScene_), commandHistory_).Exec();
+	}
+
+	void EditorView::HandleEditMenuMergeStaticCollidersReleased(StringHash, VariantMap&)
+	{
+		CommandInvoker(MakeShared<MergeStaticCollidersCommand>(editorScene_, false), commandHistory_).Exec();
+	}
+
+	void EditorView::HandleEditMenuMergeStaticCollidersChainsReleased(StringHash, VariantMap&)
+	{
+		CommandInvoker(MakeShared<MergeStaticCollidersCommand>(editorScene_, true), commandHistory_).Exec();
+	}
+
+	void EditorView::HandleEditMenuConsolidateStaticBodiesReleased(StringHash, VariantMap&)
+	{
+		CommandInvoker(MakeShared<BodyConsolidator>(context_)->Consolidate(editorScene_), commandHistory_).Exec();
+	}
+
 	void EditorView::HandleViewMenuAttributeWindowReleased(StringHash, VariantMap&)
 	{
 		attributeWindowView_->Open();
@@ -235,16 +353,40 @@ namespace Geode
 		hierarchyWindowView_->Open();
 	}
 
+	void EditorView::HandleViewMenuEventProfilerWindowReleased(StringHash, VariantMap&)
+	{
+		eventProfilerWindowView_->Open();
+	}
+
+	void EditorView::HandleViewMenuCollisionAnalysisWindowReleased(StringHash, VariantMap&)
+	{
+		collisionAnalysisWindowView_->Open();
+	}
+
+	void EditorView::HandleViewMenuRecordTraceReleased(StringHash, VariantMap&)
+	{
+		auto recorder = GetSubsystem<TraceRecorder>();
+
+		if (recorder != nullptr && !recorder->IsRecording())
+		{
+			recorder->Start(TRACE_NUM_FRAMES, GetSubsystem<FileSystem>()->GetAppPreferencesDir("urho3d", "logs") + "Trace.json");
+		}
+	}
+
 	void EditorView::HandleViewMenuCloseAllWindowReleased(StringHash, VariantMap&)
 	{
 		attributeWindowView_->Close();
 		hierarchyWindowView_->Close();
+		eventProfilerWindowView_->Close();
+		collisionAnalysisWindowView_->Close();
 	}
 
 	void EditorView::HandleViewMenuOpenAllWindowReleased(StringHash, VariantMap&)
 	{
 		attributeWindowView_->Open();
 		hierarchyWindowView_->Open();
+		eventProfilerWindowView_->Open();
+		collisionAnalysisWindowView_->Open();
 	}
 
 	void EditorView::HandleViewMenuResetWindowLayoutReleased(StringHash, VariantMap&)
@@ -267,6 +409,46 @@ namespace Geode
 		sceneView_->SetGridEnabled(eventData[Toggled::P_STATE].GetBool());
 	}
 
+	void EditorView::HandleViewMenuPerformanceHudEnabledToggled(StringHash, VariantMap& eventData)
+	{
+		sceneView_->SetPerformanceHudEnabled(eventData[Toggled::P_STATE].GetBool());
+	}
+
+	void EditorView::HandleViewMenuInputCoalescingEnabledToggled(StringHash, VariantMap& eventData)
+	{
+		sceneView_->SetInputCoalescingEnabled(eventData[Toggled::P_STATE].GetBool());
+	}
+
+	void EditorView::HandleViewMenuIdleThrottlingEnabledToggled(StringHash, VariantMap& eventData)
+	{
+		auto idleMonitor = GetSubsystem<IdleMonitor>();
+
+		if (idleMonitor != nullptr)
+		{
+			idleMonitor->SetEnabled(eventData[Toggled::P_STATE].GetBool());
+		}
+	}
+
+	void EditorView::HandleSceneLoaded(StringHash, VariantMap&)
+	{
+		fileMenuChunkedLayoutEnabledCheckBox_->SetChecked(editorScene_->GetChunkedLayout());
+		fileMenuWorldPartitionEnabledCheckBox_->SetChecked(editorScene_->GetWorldPartition()->IsEnabled());
+	}
+
+	void EditorView::HandleScenePlayingChanged(StringHash, VariantMap& eventData)
+	{
+		auto playing = eventData[ScenePlayingChanged::P_PLAYING].GetBool();
+
+		// Stopping restores the scene from its snapshot, commands would point on deleted nodes.
+		if (!playing)
+		{
+			commandHistory_->Clear();
+			editorScene_->GetWorldPartition()->ReleaseEditedCells();
+		}
+
+		editMenuPlayCheckBox_->SetChecked(playing);
+	}
+
 	void EditorView::HandleOpenSceneFileSelected(StringHash, VariantMap& eventData)
 	{
 		using namespace FileSelected;
@@ -318,9 +500,9 @@ namespace Geode
 		fileSelector_->SetDefaultStyle(uiRoot_->GetDefaultStyle());
 		fileSelector_->SetTitle("Open Scene File");
 		fileSelector_->SetButtonTexts("OPEN", "CANCEL");
-		fileSelector_->SetFilters({ ".xml" }, 0);
+		fileSelector_->SetFilters({ ".xml", ".bin" }, 0);
 
-		SubscribeToEvent(fileSelector_, E_FILESELECTED, URHO3D_HANDLER(EditorView, HandleOpenSceneFileSelected));
+		SubscribeToEvent(fileSelector_, E_FILESELECTED, GEODE_HANDLER(EditorView, HandleOpenSceneFileSelected));
 	}
 
 	void EditorView::CreateSaveSceneFileSelector()
@@ -334,8 +516,8 @@ namespace Geode
 		fileSelector_->SetDefaultStyle(uiRoot_->GetDefaultStyle());
 		fileSelector_->SetTitle("Save Scene File");
 		fileSelector_->SetButtonTexts("SAVE", "CANCEL");
-		fileSelector_->SetFilters({ ".xml" }, 0);
+		fileSelector_->SetFilters({ ".xml", ".bin" }, 0);
 
-		SubscribeToEvent(fileSelector_, E_FILESELECTED, URHO3D_HANDLER(EditorView, HandleSaveSceneFileSelected));
+		SubscribeToEvent(fileSelector_, E_FILESELECTED, GEODE_HANDLER(EditorView, HandleSaveSceneFileSelected));
 	}
 }
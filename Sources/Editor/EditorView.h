@@ -17,6 +17,8 @@
 #include "SceneView.h"
 #include "AttributeWindowView.h"
 #include "HierarchyWindowView.h"
+#include "EventProfilerWindowView.h"
+#include "CollisionAnalysisWindowView.h"
 #include "../Gui/IView.h"
 #include "../Gui/MenuBar.h"
 
@@ -40,24 +42,41 @@ namespace Geode
 		/// Event handlers.
 		void HandleFileMenuOpenReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleFileMenuSaveReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleFileMenuChunkedLayoutEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleFileMenuWorldPartitionEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleFileMenuQuitReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuUndoReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuDeleteReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuUnselectReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuPlayToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuCreateNewNodeReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuCreateStaticSprite2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuCreateRigidBody2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuCreateCollisionBox2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuCreateCollisionPolygon2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuCreateCollisionChain2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleEditMenuCreateCollisionCircle2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuGenerateCollisionPolygon2DReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuGenerateSceneCollisionReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuMergeStaticCollidersReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuMergeStaticCollidersChainsReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditMenuConsolidateStaticBodiesReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuAttributeWindowReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuHierarchyWindowReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleViewMenuEventProfilerWindowReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleViewMenuCollisionAnalysisWindowReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleViewMenuRecordTraceReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuCloseAllWindowReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuOpenAllWindowReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuResetWindowLayoutReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuDebugGeometryEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuNodePositionGizmoEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleViewMenuGridEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleViewMenuPerformanceHudEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleViewMenuInputCoalescingEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleViewMenuIdleThrottlingEnabledToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneLoaded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleScenePlayingChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleOpenSceneFileSelected(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSaveSceneFileSelected(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		
@@ -78,6 +97,8 @@ namespace Geode
 		Urho3D::SharedPtr<Geode::ToolsView> toolsView_;
 		Urho3D::SharedPtr<Geode::AttributeWindowView> attributeWindowView_;
 		Urho3D::SharedPtr<Geode::HierarchyWindowView> hierarchyWindowView_;
+		Urho3D::SharedPtr<Geode::EventProfilerWindowView> eventProfilerWindowView_;
+		Urho3D::SharedPtr<Geode::CollisionAnalysisWindowView> collisionAnalysisWindowView_;
 		Urho3D::SharedPtr<Geode::PanelView> panelView_;
 		Urho3D::SharedPtr<Geode::SceneView> sceneView_;
 		Urho3D::SharedPtr<Urho3D::FileSelector> fileSelector_;
@@ -86,19 +107,31 @@ namespace Geode
 		Urho3D::Button* fileMenuOpenButton_;
 		Urho3D::Button* fileMenuSaveButton_;
 		Urho3D::Button* fileMenuQuitButton_;
+		Urho3D::CheckBox* fileMenuChunkedLayoutEnabledCheckBox_;
+		Urho3D::CheckBox* fileMenuWorldPartitionEnabledCheckBox_;
 		Geode::FlyMenu* editMenu_;
 		Urho3D::Button* editMenuUndoButton_;
 		Urho3D::Button* editMenuDeleteButton_;
 		Urho3D::Button* editMenuUnselectButton_;
+		Urho3D::CheckBox* editMenuPlayCheckBox_;
 		Urho3D::Button* editMenuNewNodeButton_;
 		Urho3D::Button* editMenuCreateStaticSprite2DButton_;
 		Urho3D::Button* editMenuCreateRigidBody2DButton_;
 		Urho3D::Button* editMenuCreateCollisionBox2DButton_;
 		Urho3D::Button* editMenuCreateCollisionPolygon2DButton_;
+		Urho3D::Button* editMenuCreateCollisionChain2DButton_;
 		Urho3D::Button* editMenuCreateCollisionCircle2DButton_;
+		Urho3D::Button* editMenuGenerateCollisionPolygon2DButton_;
+		Urho3D::Button* editMenuGenerateSceneCollisionButton_;
+		Urho3D::Button* editMenuMergeStaticCollidersButton_;
+		Urho3D::Button* editMenuMergeStaticCollidersChainsButton_;
+		Urho3D::Button* editMenuConsolidateStaticBodiesButton_;
 		Geode::FlyMenu* viewMenu_;
 		Urho3D::Button* viewMenuAttributeWindowButton_;
 		Urho3D::Button* viewMenuHierarchyWindowButton_;
+		Urho3D::Button* viewMenuEventProfilerWindowButton_;
+		Urho3D::Button* viewMenuCollisionAnalysisWindowButton_;
+		Urho3D::Button* viewMenuRecordTraceButton_;
 		Urho3D::Button* viewMenuCloseAllWindowButton_;
 		Urho3D::Button* viewMenuOpenAllWindowButton_;
 		Urho3D::Button* viewMenuResetWindowLayoutButton_;
@@ -106,5 +139,8 @@ namespace Geode
 		Urho3D::CheckBox* viewMenuDebugGeometryEnabledCheckBox_;
 		Urho3D::CheckBox* viewMenuNodePositionGizmoEnabledCheckBox_;
 		Urho3D::CheckBox* viewMenuGridEnabledCheckBox_;
+		Urho3D::CheckBox* viewMenuPerformanceHudEnabledCheckBox_;
+		Urho3D::CheckBox* viewMenuInputCoalescingEnabledCheckBox_;
+		Urho3D::CheckBox* viewMenuIdleThrottlingEnabledCheckBox_;
 	};
 }
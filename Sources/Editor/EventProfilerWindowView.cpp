@@ -0,0 +1,163 @@
+#include "EventProfilerWindowView.h"
+
+#include <Urho3D/UI/UIEvents.h>
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/FileSystem.h>
+
+using namespace Urho3D;
+
+static const unsigned MAX_ROWS = 24;
+static const unsigned REFRESH_INTERVAL_MS = 500;
+static const String DUMP_FILENAME = "EventProfile.json";
+static const String START_RECORDING_TEXT = "Start recording";
+static const String STOP_RECORDING_TEXT = "Stop recording";
+
+namespace Geode
+{
+	EventProfilerWindowView::EventProfilerWindowView(Context* context) : IWindowView(context, "UI/EventProfilerWindowView.xml")
+	{
+		handlersText_ = elRoot_->GetChildDynamicCast<Text>("HandlersText", true);
+		assert(handlersText_);
+
+		statusText_ = elRoot_->GetChildDynamicCast<Text>("StatusText", true);
+		assert(statusText_);
+
+		recordButton_ = elRoot_->GetChildDynamicCast<Button>("RecordButton", true);
+		assert(recordButton_);
+
+		recordButtonLabel_ = elRoot_->GetChildDynamicCast<Text>("RecordButtonLabel", true);
+		assert(recordButtonLabel_);
+
+		clearButton_ = elRoot_->GetChildDynamicCast<Button>("ClearButton", true);
+		assert(clearButton_);
+
+		dumpButton_ = elRoot_->GetChildDynamicCast<Button>("DumpButton", true);
+		assert(dumpButton_);
+
+		SubscribeToEvent(recordButton_, E_RELEASED, GEODE_HANDLER(EventProfilerWindowView, HandleRecordButtonReleased));
+		SubscribeToEvent(clearButton_, E_RELEASED, GEODE_HANDLER(EventProfilerWindowView, HandleClearButtonReleased));
+		SubscribeToEvent(dumpButton_, E_RELEASED, GEODE_HANDLER(EventProfilerWindowView, HandleDumpButtonReleased));
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void EventProfilerWindowView::SetRecording(bool recording)
+	{
+		auto profiler = GetSubsystem<EventProfiler>();
+
+		if (profiler == nullptr || recording == profiler->IsEnabled())
+		{
+			return;
+		}
+
+		profiler->SetEnabled(recording);
+		recordButtonLabel_->SetText(recording ? STOP_RECORDING_TEXT : START_RECORDING_TEXT);
+
+		// The list is refreshed while recording only, the window itself costs nothing otherwise.
+		if (recording)
+		{
+			refreshTimer_.Reset();
+			SubscribeToEvent(E_UPDATE, GEODE_HANDLER(EventProfilerWindowView, HandleUpdate));
+		}
+		else
+		{
+			UnsubscribeFromEvent(E_UPDATE);
+			UpdateHandlersText();
+		}
+	}
+
+	bool EventProfilerWindowView::IsRecording()
+	{
+		auto profiler = GetSubsystem<EventProfiler>();
+		return profiler != nullptr && profiler->IsEnabled();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void EventProfilerWindowView::UpdateHandlersText()
+	{
+		auto profiler = GetSubsystem<EventProfiler>();
+
+		if (profiler == nullptr)
+		{
+			handlersText_->SetText("Event profiler unavailable.");
+			return;
+		}
+
+		PODVector<const EventProfiler::Entry*> entries;
+		profiler->GetEntries(entries);
+
+		if (entries.Empty())
+		{
+			handlersText_->SetText(IsRecording() ? "No handler called yet." : "Not recording.");
+			return;
+		}
+
+		String text = "Total ms | Calls | Mean us | Max us | Event > Subscriber";
+
+		for (unsigned i = 0; i < entries.Size() && i < MAX_ROWS; i++)
+		{
+			auto entry = entries[i];
+			text += ToString("\n%.2f | %u | %.1f | %lld | ", entry->time / 1000.0, entry->count, (double)entry->time / entry->count, entry->maxTime);
+			text += entry->eventName + " > " + entry->receiverName;
+		}
+
+		if (entries.Size() > MAX_ROWS)
+		{
+			text += ToString("\n... %u more", entries.Size() - MAX_ROWS);
+		}
+
+		handlersText_->SetText(text);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void EventProfilerWindowView::HandleUpdate(StringHash, VariantMap&)
+	{
+		if (refreshTimer_.GetMSec(false) >= REFRESH_INTERVAL_MS)
+		{
+			refreshTimer_.Reset();
+			UpdateHandlersText();
+		}
+	}
+
+	void EventProfilerWindowView::HandleRecordButtonReleased(StringHash, VariantMap&)
+	{
+		SetRecording(!IsRecording());
+	}
+
+	void EventProfilerWindowView::HandleClearButtonReleased(StringHash, VariantMap&)
+	{
+		auto profiler = GetSubsystem<EventProfiler>();
+
+		if (profiler != nullptr)
+		{
+			profiler->Clear();
+		}
+
+		statusText_->SetText(String::EMPTY);
+		UpdateHandlersText();
+	}
+
+	void EventProfilerWindowView::HandleDumpButtonReleased(StringHash, VariantMap&)
+	{
+		auto profiler = GetSubsystem<EventProfiler>();
+		auto filename = GetSubsystem<FileSystem>()->GetAppPreferencesDir("urho3d", "logs") + DUMP_FILENAME;
+
+		if (profiler != nullptr && profiler->Save(filename))
+		{
+			statusText_->SetText("Saved to " + filename);
+		}
+		else
+		{
+			statusText_->SetText("Failed to save " + filename);
+		}
+	}
+}
\ No newline at end of file
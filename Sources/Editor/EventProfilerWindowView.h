@@ -0,0 +1,52 @@
+/**
+ * @file    EventProfilerWindowView.h
+ * @ingroup Editor
+ * @brief   WindowView to record and dump event handler timings.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "../Gui/IWindowView.h"
+#include "../Gui/EventProfiler.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/Timer.h>
+
+namespace Geode
+{
+	class EventProfilerWindowView : public Geode::IWindowView
+	{
+		URHO3D_OBJECT(EventProfilerWindowView, Geode::IWindowView)
+
+	public:
+		/// Constructors.
+		explicit EventProfilerWindowView(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetRecording(bool recording);
+		bool IsRecording();
+
+		/// Other methods.
+		void UpdateHandlersText();
+
+	private:
+		/// Event handlers.
+		void HandleUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleRecordButtonReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleClearButtonReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleDumpButtonReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+	private:
+		Urho3D::Text* handlersText_;
+		Urho3D::Text* statusText_;
+		Urho3D::Button* recordButton_;
+		Urho3D::Text* recordButtonLabel_;
+		Urho3D::Button* clearButton_;
+		Urho3D::Button* dumpButton_;
+		Urho3D::Timer refreshTimer_;
+	};
+}
\ No newline at end of file
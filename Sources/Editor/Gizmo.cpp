@@ -1,4 +1,6 @@
 #include "Gizmo.h"
+#include "EditorProfiler.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/Scene/SceneEvents.h>
 #include <Urho3D/Graphics/Model.h>
@@ -34,7 +36,7 @@ namespace Geode
 		yAxisModel_->SetOccludee(false);
 		yAxisModel_->SetEnabled(false);
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(Gizmo, HandleSceneUpdate));
+		SubscribeToEvent(editorScene_, E_EDITORUPDATE, GEODE_HANDLER(Gizmo, HandleEditorUpdate));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -62,12 +64,31 @@ namespace Geode
 		return enabled_;
 	}
 
+	unsigned Gizmo::GetNumGeometries()
+	{
+		auto numGeometries = 0U;
+
+		if (xAxisModel_->IsEnabled())
+		{
+			numGeometries += xAxisModel_->GetNumGeometries();
+		}
+
+		if (yAxisModel_->IsEnabled())
+		{
+			numGeometries += yAxisModel_->GetNumGeometries();
+		}
+
+		return numGeometries;
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
-	void Gizmo::HandleSceneUpdate(StringHash, VariantMap&)
+	void Gizmo::HandleEditorUpdate(StringHash, VariantMap&)
 	{
+		GEODE_PROFILE("Gizmo");
+
 		UpdateRender();
 	}
 
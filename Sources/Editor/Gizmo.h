@@ -30,10 +30,11 @@ namespace Geode
 		void SetEnabled(bool enabled);
 		void SetAttachedNode(Urho3D::Node* node);
 		bool IsEnabled();
+		unsigned GetNumGeometries();
 
 	private:
 		/// Event handlers.
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
 		/// Update methods.
 		void UpdateRender();
@@ -1,4 +1,6 @@
 #include "Grid.h"
+#include "EditorProfiler.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/Scene/SceneEvents.h>
 #include <Urho3D/Resource/ResourceCache.h>
@@ -29,8 +31,8 @@ namespace Geode
 		gridGeometry_->SetOccludee(false);
 		gridGeometry_->SetEnabled(false);
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(Grid, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SCENELOADED, URHO3D_HANDLER(Grid, HandleSceneLoaded));
+		SubscribeToEvent(editorScene_, E_EDITORUPDATE, GEODE_HANDLER(Grid, HandleEditorUpdate));
+		SubscribeToEvent(editorScene_, E_SCENELOADED, GEODE_HANDLER(Grid, HandleSceneLoaded));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -50,12 +52,19 @@ namespace Geode
 		return enabled_;
 	}
 
+	unsigned Grid::GetNumGeometries()
+	{
+		return gridGeometry_->IsEnabled() ? gridGeometry_->GetNumGeometries() : 0;
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
-	void Grid::HandleSceneUpdate(StringHash, VariantMap&)
+	void Grid::HandleEditorUpdate(StringHash, VariantMap&)
 	{
+		GEODE_PROFILE("Grid");
+
 		UpdateRender();
 	}
 
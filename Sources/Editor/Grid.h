@@ -44,10 +44,11 @@ namespace Geode
 		/// Accessors & Mutators.
 		void SetEnabled(bool enabled_);
 		bool IsEnabled();
+		unsigned GetNumGeometries();
 
 	private:
 		/// Event handlers.
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneLoaded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
 		/// Update methods.
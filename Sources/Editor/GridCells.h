@@ -0,0 +1,57 @@
+/**
+ * @file    GridCells.h
+ * @ingroup Editor
+ * @brief   Walk of the occupied cells of a sparse uniform grid covered by a range of cell coordinates.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Math/Vector2.h>
+
+namespace Geode
+{
+	class GridCells
+	{
+	public:
+		/// Other methods.
+		template<typename T, typename V> static void Visit(const Urho3D::HashMap<Urho3D::IntVector2, T>& cells, const Urho3D::IntVector2& minCoords, const Urho3D::IntVector2& maxCoords, V visitor);
+	};
+
+	template<typename T, typename V>
+	void GridCells::Visit(const Urho3D::HashMap<Urho3D::IntVector2, T>& cells, const Urho3D::IntVector2& minCoords, const Urho3D::IntVector2& maxCoords, V visitor)
+	{
+		// Wide queries over a sparse grid walk the occupied cells rather than every covered one.
+		auto numCoveredCells = (long long)(maxCoords.x_ - minCoords.x_ + 1) * (maxCoords.y_ - minCoords.y_ + 1);
+
+		if (numCoveredCells > (long long)cells.Size())
+		{
+			for (auto& cell : cells)
+			{
+				if (cell.first_.x_ >= minCoords.x_ && cell.first_.x_ <= maxCoords.x_ && cell.first_.y_ >= minCoords.y_ && cell.first_.y_ <= maxCoords.y_)
+				{
+					visitor(cell.second_);
+				}
+			}
+		}
+		else
+		{
+			for (auto y = minCoords.y_; y <= maxCoords.y_; y++)
+			{
+				for (auto x = minCoords.x_; x <= maxCoords.x_; x++)
+				{
+					auto cellIt = cells.Find(Urho3D::IntVector2(x, y));
+
+					if (cellIt != cells.End())
+					{
+						visitor(cellIt->second_);
+					}
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include "HierarchyWindowView.h"
+#include "EditorProfiler.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
 
 #include <Urho3D/Scene/SceneEvents.h>
 #include <Urho3D/UI/UIEvents.h>
@@ -28,19 +31,20 @@ namespace Geode
 		createNodeButton_ = elRoot_->GetChildDynamicCast<Button>("CreateNodeButton", true);
 		assert(createNodeButton_);
 
+		updatingList_ = false;
 		UpdateHierarchyList();
-		SetSelectedObject(editorScene_->GetSelectedObject());
-
-		SubscribeToEvent(hierarchyList_, E_ITEMSELECTED, URHO3D_HANDLER(HierarchyWindowView, HandleSelectedItem));
-		SubscribeToEvent(editorScene_, E_SCENELOADED, URHO3D_HANDLER(HierarchyWindowView, HandleSceneLoaded));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(HierarchyWindowView, HandleSelectedObjectChanged));
-		SubscribeToEvent(editorScene_, E_NODENAMECHANGED, URHO3D_HANDLER(HierarchyWindowView, HandleSceneNodeNameChanged));
-		SubscribeToEvent(editorScene_, E_NODEADDED, URHO3D_HANDLER(HierarchyWindowView, HandleSceneNodeAdded));
-		SubscribeToEvent(editorScene_, E_NODEREMOVED, URHO3D_HANDLER(HierarchyWindowView, HandleSceneNodeRemoved));
-		SubscribeToEvent(editorScene_, E_COMPONENTADDED, URHO3D_HANDLER(HierarchyWindowView, HandleSceneComponentAdded));
-		SubscribeToEvent(editorScene_, E_COMPONENTREMOVED, URHO3D_HANDLER(HierarchyWindowView, HandleSceneComponentRemoved));
-		SubscribeToEvent(deleteButton_, E_RELEASED, URHO3D_HANDLER(HierarchyWindowView, HandleDeleteButtonReleased));
-		SubscribeToEvent(createNodeButton_, E_RELEASED, URHO3D_HANDLER(HierarchyWindowView, HandleCreateNodeButtonReleased));
+
+		SubscribeToEvent(hierarchyList_, E_SELECTIONCHANGED, GEODE_HANDLER(HierarchyWindowView, HandleSelectionChanged));
+		SubscribeToEvent(editorScene_, E_SCENELOADED, GEODE_HANDLER(HierarchyWindowView, HandleSceneLoaded));
+		SubscribeToEvent(editorScene_, E_SCENECELLSCHANGED, GEODE_HANDLER(HierarchyWindowView, HandleSceneCellsChanged));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(HierarchyWindowView, HandleSelectedObjectChanged));
+		SubscribeToEvent(editorScene_, E_NODENAMECHANGED, GEODE_HANDLER(HierarchyWindowView, HandleSceneNodeNameChanged));
+		SubscribeToEvent(editorScene_, E_NODEADDED, GEODE_HANDLER(HierarchyWindowView, HandleSceneNodeAdded));
+		SubscribeToEvent(editorScene_, E_NODEREMOVED, GEODE_HANDLER(HierarchyWindowView, HandleSceneNodeRemoved));
+		SubscribeToEvent(editorScene_, E_COMPONENTADDED, GEODE_HANDLER(HierarchyWindowView, HandleSceneComponentAdded));
+		SubscribeToEvent(editorScene_, E_COMPONENTREMOVED, GEODE_HANDLER(HierarchyWindowView, HandleSceneComponentRemoved));
+		SubscribeToEvent(deleteButton_, E_RELEASED, GEODE_HANDLER(HierarchyWindowView, HandleDeleteButtonReleased));
+		SubscribeToEvent(createNodeButton_, E_RELEASED, GEODE_HANDLER(HierarchyWindowView, HandleCreateNodeButtonReleased));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -52,43 +56,56 @@ namespace Geode
 		UpdateHierarchyList();
 	}
 
-	void HierarchyWindowView::HandleSelectedObjectChanged(StringHash, VariantMap&)
+	void HierarchyWindowView::HandleSceneCellsChanged(StringHash, VariantMap&)
 	{
-		auto selectedObject = editorScene_->GetSelectedObject();
-		auto selectedItem = hierarchyList_->GetSelectedItem();
-
-		if (selectedItem && selectedItem->GetVar(VAR_OBJECT_PTR).GetPtr() == selectedObject)
-		{
-			return;
-		}
+		UpdateHierarchyList();
+	}
 
-		SetSelectedObject(selectedObject);
+	void HierarchyWindowView::HandleSelectedObjectChanged(StringHash, VariantMap&)
+	{
+		SetSelectedObjects();
 	}
 
-	void HierarchyWindowView::HandleSelectedItem(StringHash, VariantMap&)
+	void HierarchyWindowView::HandleSelectionChanged(StringHash, VariantMap&)
 	{
-		auto selectedItem = hierarchyList_->GetSelectedItem();
-		auto selectedItemObject = static_cast<Object*>(selectedItem->GetVar(VAR_OBJECT_PTR).GetPtr());
+		GEODE_TRACE("HierarchyWindowView::HandleSelectionChanged", "ui");
 
-		if (selectedItemObject == nullptr)
+		if (updatingList_)
 		{
 			return;
 		}
 
-		if (selectedItemObject->IsInstanceOf<Scene>())
+		HashSet<Object*> listedObjects;
+
+		for (auto index : hierarchyList_->GetSelections())
 		{
-			editorScene_->ClearSelection();
-			return;
+			auto object = static_cast<Object*>(hierarchyList_->GetItem(index)->GetVar(VAR_OBJECT_PTR).GetPtr());
+
+			if (object != nullptr && !object->IsInstanceOf<Scene>())
+			{
+				listedObjects.Insert(object);
+			}
 		}
 
-		if (selectedItemObject->IsInstanceOf<Node>())
+		// Keep objects still listed in their original order, so the primary selection stays stable.
+		auto selectedObjects = editorScene_->GetSelectedObjects();
+
+		for (auto object : selectedObjects)
 		{
-			editorScene_->SetSelectedObject(static_cast<Node*>(selectedItemObject));
+			if (!listedObjects.Erase(object))
+			{
+				editorScene_->RemoveSelectedObject(object);
+			}
 		}
 
-		if (selectedItemObject->IsInstanceOf<Component>())
+		for (auto index : hierarchyList_->GetSelections())
 		{
-			editorScene_->SetSelectedObject(static_cast<Component*>(selectedItemObject));
+			auto object = static_cast<Object*>(hierarchyList_->GetItem(index)->GetVar(VAR_OBJECT_PTR).GetPtr());
+
+			if (listedObjects.Contains(object))
+			{
+				editorScene_->AddSelectedObject(object);
+			}
 		}
 	}
 
@@ -144,23 +161,23 @@ namespace Geode
 	///  ACCESSORS & MUTATORS
 	///------------------------------------------------------------------------------------------------
 
-	void HierarchyWindowView::SetSelectedObject(Object* object)
+	void HierarchyWindowView::SetSelectedObjects()
 	{
-		if (object == nullptr)
-		{
-			hierarchyList_->ClearSelection();
-		}
+		GEODE_TRACE("HierarchyWindowView::SetSelectedObjects", "ui");
 
-		int index = IndexOfObject(object);
+		PODVector<unsigned> indices;
 
-		if (index == -1)
+		for (unsigned i = 0; i < hierarchyList_->GetNumItems(); i++)
 		{
-			hierarchyList_->ClearSelection();
-		}
-		else
-		{
-			hierarchyList_->SetSelection(index);
+			if (editorScene_->IsSelected(static_cast<Object*>(hierarchyList_->GetItem(i)->GetVar(VAR_OBJECT_PTR).GetPtr())))
+			{
+				indices.Push(i);
+			}
 		}
+
+		updatingList_ = true;
+		hierarchyList_->SetSelections(indices);
+		updatingList_ = false;
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -169,11 +186,17 @@ namespace Geode
 
 	void HierarchyWindowView::UpdateHierarchyList()
 	{
+		GEODE_PROFILE("Hierarchy");
+
+		updatingList_ = true;
 		hierarchyList_->RemoveAllItems();
 		AddNode(editorScene_, nullptr);
+		updatingList_ = false;
 
 		removedNodesBuf_.Clear();
 		removedComponentsBuf_.Clear();
+
+		SetSelectedObjects();
 	}
 
 	UIElement* HierarchyWindowView::AddNode(Node* node, UIElement* parentItem)
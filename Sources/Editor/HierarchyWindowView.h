@@ -29,11 +29,15 @@ namespace Geode
 	public:
 		/// Constructors.
 		explicit HierarchyWindowView(Urho3D::Context* context, Geode::CommandHistory::Ptr commandHistory, Geode::EditorScene::Ptr editorScene);
-		
+
+		/// Other methods.
+		void UpdateHierarchyList();
+
 	private:
 		/// Event handlers.
-		void HandleSelectedItem(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSelectionChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneLoaded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneCellsChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneNodeNameChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSceneNodeAdded(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
@@ -44,10 +48,9 @@ namespace Geode
 		void HandleCreateNodeButtonReleased(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
 		/// Accessors & Mutators.
-		void SetSelectedObject(Urho3D::Object* object);
+		void SetSelectedObjects();
 
 		/// Other methods.
-		void UpdateHierarchyList();
 		Urho3D::UIElement* AddNode(Urho3D::Node* node, Urho3D::UIElement* parentItem);
 		Urho3D::UIElement* AddComponent(Urho3D::Component* component, Urho3D::UIElement* parentItem);
 		Urho3D::UIElement* FindItem(Urho3D::Object* object);
@@ -61,5 +64,6 @@ namespace Geode
 		Urho3D::Button* createNodeButton_;
 		Urho3D::Vector<Urho3D::Component*> removedComponentsBuf_;
 		Urho3D::Vector<Urho3D::Node*> removedNodesBuf_;
+		bool updatingList_;
 	};
 }
@@ -39,4 +39,36 @@ namespace Geode
 	{
 		return false;
 	}
+
+	void ITool::Deactivate()
+	{
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void ITool::HandleEditorUpdate(StringHash, VariantMap&)
+	{
+	}
+
+	void ITool::HandleKeyDown(StringHash, VariantMap&)
+	{
+	}
+
+	void ITool::HandleSceneViewDragBegin(StringHash, VariantMap&)
+	{
+	}
+
+	void ITool::HandleSceneViewDragMove(StringHash, VariantMap&)
+	{
+	}
+
+	void ITool::HandleSceneViewDragEnd(StringHash, VariantMap&)
+	{
+	}
+
+	void ITool::HandleSceneViewDragCancel(StringHash, VariantMap&)
+	{
+	}
 }
\ No newline at end of file
@@ -35,6 +35,15 @@ namespace Geode
 		/// Other methods.
 		virtual Urho3D::UIElement* PopulateToolBar(Geode::ToolBar* toolBar);
 		virtual bool IsActive();
+		virtual void Deactivate();
+
+		/// Event handlers, forwarded by the tools view to active tools only.
+		virtual void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		virtual void HandleKeyDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		virtual void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		virtual void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		virtual void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		virtual void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
 	private:
 		bool enabled_;
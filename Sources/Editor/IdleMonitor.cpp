@@ -0,0 +1,176 @@
+#include "IdleMonitor.h"
+#include "EditorSceneEvents.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Graphics/GraphicsEvents.h>
+#include <Urho3D/Input/Input.h>
+#include <Urho3D/Resource/ResourceEvents.h>
+#include <Urho3D/Scene/SceneEvents.h>
+
+#include <SDL/SDL.h>
+
+using namespace Urho3D;
+
+static const unsigned IDLE_DELAY_MS = 1000;
+static const unsigned IDLE_FRAME_INTERVAL_MS = 250;
+static const unsigned IDLE_POLL_INTERVAL_MS = 5;
+
+namespace Geode
+{
+	IdleMonitor::IdleMonitor(Context* context) : Object(context)
+	{
+		enabled_ = true;
+		keepAwake_ = false;
+		playing_ = false;
+		sleepTime_ = 0;
+
+		// Input, window and resource events.
+		SubscribeToEvent(E_MOUSEBUTTONDOWN, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_MOUSEBUTTONUP, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_MOUSEMOVE, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_MOUSEWHEEL, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_TEXTINPUT, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_DROPFILE, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_SCREENMODE, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_FILECHANGED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_RELOADFINISHED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_RELOADFAILED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_KEYDOWN, GEODE_HANDLER(IdleMonitor, HandleKeyDown));
+		SubscribeToEvent(E_KEYUP, GEODE_HANDLER(IdleMonitor, HandleKeyUp));
+		SubscribeToEvent(E_INPUTFOCUS, GEODE_HANDLER(IdleMonitor, HandleInputFocus));
+
+		// Scene events, from any sender.
+		SubscribeToEvent(E_SCENELOADED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_SCENECELLSCHANGED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_NODEADDED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_NODEREMOVED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_COMPONENTADDED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_COMPONENTREMOVED, GEODE_HANDLER(IdleMonitor, HandleActivity));
+		SubscribeToEvent(E_SCENEPLAYINGCHANGED, GEODE_HANDLER(IdleMonitor, HandleScenePlayingChanged));
+
+		SubscribeToEvent(E_ENDFRAME, GEODE_HANDLER(IdleMonitor, HandleEndFrame));
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void IdleMonitor::SetEnabled(bool enabled)
+	{
+		if (enabled != enabled_)
+		{
+			enabled_ = enabled;
+			Wake();
+		}
+	}
+
+	bool IdleMonitor::IsEnabled() const
+	{
+		return enabled_;
+	}
+
+	bool IdleMonitor::IsIdle() const
+	{
+		return enabled_ && !IsBusy() && activityTimer_.GetMSec(false) >= IDLE_DELAY_MS;
+	}
+
+	long long IdleMonitor::GetSleepTime() const
+	{
+		return sleepTime_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void IdleMonitor::Wake()
+	{
+		activityTimer_.Reset();
+	}
+
+	void IdleMonitor::KeepAwake()
+	{
+		keepAwake_ = true;
+	}
+
+	bool IdleMonitor::IsBusy() const
+	{
+		auto input = GetSubsystem<Input>();
+
+		// Held keys and buttons drive per-frame work (camera moves, drags) without sending events.
+		if (!keysDown_.Empty() || (input != nullptr && input->GetMouseButtonDown(MOUSEB_ANY)))
+		{
+			return true;
+		}
+
+		// A playing scene animates and simulates on its own.
+		return keepAwake_ || playing_ || TraceRecorder::GetActive() != nullptr;
+	}
+
+	void IdleMonitor::Sleep()
+	{
+		HiresTimer sleepTimer;
+
+		// Sleep by small steps, so pending OS events end the nap instead of waiting for the next idle frame.
+		while (sleepTimer.GetUSec(false) < IDLE_FRAME_INTERVAL_MS * 1000LL)
+		{
+			SDL_PumpEvents();
+
+			if (SDL_HasEvents(SDL_FIRSTEVENT, SDL_LASTEVENT))
+			{
+				break;
+			}
+
+			Time::Sleep(IDLE_POLL_INTERVAL_MS);
+		}
+
+		sleepTime_ += sleepTimer.GetUSec(false);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void IdleMonitor::HandleActivity(StringHash, VariantMap&)
+	{
+		Wake();
+	}
+
+	void IdleMonitor::HandleKeyDown(StringHash, VariantMap& eventData)
+	{
+		keysDown_.Insert(eventData[KeyDown::P_KEY].GetInt());
+		Wake();
+	}
+
+	void IdleMonitor::HandleKeyUp(StringHash, VariantMap& eventData)
+	{
+		keysDown_.Erase(eventData[KeyUp::P_KEY].GetInt());
+		Wake();
+	}
+
+	void IdleMonitor::HandleInputFocus(StringHash, VariantMap&)
+	{
+		// Key releases are lost while the window is unfocused.
+		keysDown_.Clear();
+		Wake();
+	}
+
+	void IdleMonitor::HandleScenePlayingChanged(StringHash, VariantMap& eventData)
+	{
+		playing_ = eventData[ScenePlayingChanged::P_PLAYING].GetBool();
+		Wake();
+	}
+
+	void IdleMonitor::HandleEndFrame(StringHash, VariantMap&)
+	{
+		if (IsIdle())
+		{
+			Sleep();
+		}
+
+		keepAwake_ = false;
+	}
+}
\ No newline at end of file
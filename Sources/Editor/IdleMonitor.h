@@ -0,0 +1,58 @@
+/**
+ * @file    IdleMonitor.h
+ * @ingroup Editor
+ * @brief   Throttles the editor frame rate while nothing happens.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Container/HashSet.h>
+
+namespace Geode
+{
+	class IdleMonitor : public Urho3D::Object
+	{
+		URHO3D_OBJECT(IdleMonitor, Urho3D::Object)
+
+	public:
+		/// Constructors.
+		explicit IdleMonitor(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetEnabled(bool enabled);
+		bool IsEnabled() const;
+		bool IsIdle() const;
+		long long GetSleepTime() const;
+
+		/// Other methods.
+		void Wake();
+		void KeepAwake();
+
+	private:
+		/// Event handlers.
+		void HandleActivity(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleKeyDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleKeyUp(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleInputFocus(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleScenePlayingChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEndFrame(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Other methods.
+		bool IsBusy() const;
+		void Sleep();
+
+	private:
+		bool enabled_;
+		bool keepAwake_;
+		bool playing_;
+		long long sleepTime_;
+		Urho3D::Timer activityTimer_;
+		Urho3D::HashSet<int> keysDown_;
+	};
+}
\ No newline at end of file
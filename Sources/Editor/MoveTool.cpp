@@ -1,4 +1,5 @@
 #include "MoveTool.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/Scene/SceneEvents.h>
@@ -21,12 +22,7 @@ namespace Geode
 
 		SetSelectedNode(editorScene_->GetSelectedNode());
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(MoveTool, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(MoveTool, HandleSelectedObjectChanged));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, URHO3D_HANDLER(MoveTool, HandleSceneViewDragBegin));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, URHO3D_HANDLER(MoveTool, HandleSceneViewDragMove));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, URHO3D_HANDLER(MoveTool, HandleSceneViewDragEnd));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, URHO3D_HANDLER(MoveTool, HandleSceneViewDragCancel));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(MoveTool, HandleSelectedObjectChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -48,7 +44,7 @@ namespace Geode
 		radio_ = toolBar->AddIconRadio("MoveToolRadio", "NodeToolRgn", "IconMove", "Move");
 		EnableRadio(IsEnabled());
 
-		SubscribeToEvent(radio_, E_TOGGLED, URHO3D_HANDLER(MoveTool, HandleRadioToggled));
+		SubscribeToEvent(radio_, E_TOGGLED, GEODE_HANDLER(MoveTool, HandleRadioToggled));
 		return radio_;
 	}
 
@@ -57,13 +53,17 @@ namespace Geode
 		return IsEnabled() && radio_->IsChecked() && selectedNode_ != nullptr;
 	}
 
+	void MoveTool::Deactivate()
+	{
+		editing_ = false;
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void MoveTool::HandleSceneUpdate(StringHash, VariantMap&)
+	void MoveTool::HandleEditorUpdate(StringHash, VariantMap&)
 	{
-		UpdateEditingState();
 		UpdateCursor();
 	}
 
@@ -74,13 +74,12 @@ namespace Geode
 
 	void MoveTool::HandleSceneViewDragBegin(StringHash, VariantMap&)
 	{
-		if (!IsActive() || !sceneView_->IsMouseInsideNode(selectedNode_))
+		if (!IsActive() || !sceneView_->IsMouseInsideSelection())
 		{
 			return;
 		}
 
-		currentNodePosition_ = beginNodePosition_ = selectedNode_->GetWorldPosition2D();
-		editing_ = true;
+		BeginEditing();
 	}
 
 	void MoveTool::HandleSceneViewDragMove(StringHash, VariantMap& eventData)
@@ -91,8 +90,12 @@ namespace Geode
 		}
 
 		auto delta = Vector2(eventData[SceneViewDragMove::P_DX].GetFloat(), eventData[SceneViewDragMove::P_DY].GetFloat());
-		currentNodePosition_ = beginNodePosition_ + delta;
-		selectedNode_->SetWorldPosition2D(currentNodePosition_);
+
+		for (unsigned i = 0; i < editedNodes_.Size(); i++)
+		{
+			currentTransforms_[i].position = beginTransforms_[i].position + delta;
+			editedNodes_[i]->SetWorldPosition2D(currentTransforms_[i].position);
+		}
 	}
 
 	void MoveTool::HandleSceneViewDragEnd(StringHash, VariantMap&)
@@ -102,7 +105,7 @@ namespace Geode
 			return;
 		}
 
-		CommandInvoker(MakeShared<MoveNodeCommand>(editorScene_, beginNodePosition_, currentNodePosition_), commandHistory_).Exec();
+		CommandInvoker(MakeShared<TransformNodesCommand>(editorScene_, editedNodes_, beginTransforms_, currentTransforms_), commandHistory_).Exec();
 		editing_ = false;
 	}
 
@@ -113,7 +116,7 @@ namespace Geode
 			return;
 		}
 
-		selectedNode_->SetWorldPosition2D(beginNodePosition_);
+		TransformNodesCommand::SetWorldTransforms(editedNodes_, beginTransforms_);
 		editing_ = false;
 	}
 
@@ -132,14 +135,6 @@ namespace Geode
 	///  UPDATE METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void MoveTool::UpdateEditingState()
-	{
-		if (!IsActive())
-		{
-			editing_ = false;
-		}
-	}
-
 	void MoveTool::UpdateCursor()
 	{
 		if (!IsActive())
@@ -147,7 +142,7 @@ namespace Geode
 			return;
 		}
 
-		if (editing_ || sceneView_->IsMouseInsideNode(selectedNode_))
+		if (editing_ || sceneView_->IsMouseInsideSelection())
 		{
 			cursor_->SetShape(ACTIVE_CURSOR_SHAPE);
 		}
@@ -175,6 +170,13 @@ namespace Geode
 	///  OTHER METHODS
 	///------------------------------------------------------------------------------------------------
 
+	void MoveTool::BeginEditing()
+	{
+		TransformNodesCommand::GetSelectedWorldTransforms(editorScene_, editedNodes_, beginTransforms_);
+		currentTransforms_ = beginTransforms_;
+		editing_ = true;
+	}
+
 	void MoveTool::EnableRadio(bool enable)
 	{
 		if (radio_ == nullptr)
@@ -1,4 +1,5 @@
 #include "PanelView.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/UI/UI.h>
 
@@ -23,8 +24,8 @@ namespace Geode
 		scrollContent_->SetMinWidth(scrollView_->GetWidth() - 4);
 		scrollView_->SetContentElement(scrollContent_);
 
-		SubscribeToEvent(tabBar_, E_TAB_SELECTION_CHANGED, URHO3D_HANDLER(PanelView, HandleTabSelectionChanged));
-		SubscribeToEvent(tabBar_, E_TAB_REMOVED, URHO3D_HANDLER(PanelView, HandleTabRemoved));
+		SubscribeToEvent(tabBar_, E_TAB_SELECTION_CHANGED, GEODE_HANDLER(PanelView, HandleTabSelectionChanged));
+		SubscribeToEvent(tabBar_, E_TAB_REMOVED, GEODE_HANDLER(PanelView, HandleTabRemoved));
 	}
 
 	bool PanelView::RegisterWindowView(SharedPtr<IWindowView> windowView)
@@ -36,9 +37,9 @@ namespace Geode
 
 		registeredWindowViews_.Push(windowView);
 
-		SubscribeToEvent(windowView, E_WINDOWVIEW_CLOSED, URHO3D_HANDLER(PanelView, HandleWindowViewClosed));
-		SubscribeToEvent(windowView, E_WINDOWVIEW_OPENED, URHO3D_HANDLER(PanelView, HandleWindowViewOpened));
-		SubscribeToEvent(windowView, E_WINDOWVIEW_DRAGEND, URHO3D_HANDLER(PanelView, HandleWindowViewDragEnd));
+		SubscribeToEvent(windowView, E_WINDOWVIEW_CLOSED, GEODE_HANDLER(PanelView, HandleWindowViewClosed));
+		SubscribeToEvent(windowView, E_WINDOWVIEW_OPENED, GEODE_HANDLER(PanelView, HandleWindowViewOpened));
+		SubscribeToEvent(windowView, E_WINDOWVIEW_DRAGEND, GEODE_HANDLER(PanelView, HandleWindowViewDragEnd));
 		
 		return true;
 	}
@@ -0,0 +1,239 @@
+#include "PerformanceHud.h"
+#include "IdleMonitor.h"
+#include "../Gui/EventProfiler.h"
+
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Graphics/Graphics.h>
+#include <Urho3D/Graphics/Renderer.h>
+
+using namespace Urho3D;
+
+static const char* BLOCK_NAMES[] = { "Grid", "Gizmo", "Tools", "Hierarchy", "Inspector" };
+static const unsigned NUM_BLOCKS = sizeof(BLOCK_NAMES) / sizeof(BLOCK_NAMES[0]);
+static const unsigned REFRESH_INTERVAL_MS = 250;
+static const int HUD_MARGIN = 8;
+static const int HUD_PRIORITY = 100;
+static const unsigned GRAPH_NUM_BARS = 100;
+static const int GRAPH_BAR_WIDTH = 2;
+static const int GRAPH_HEIGHT = 48;
+static const float GRAPH_MAX_FRAME_TIME = 50.0f;
+static const float TARGET_FRAME_TIME = 1000.0f / 60.0f;
+static const Color GRAPH_BACKGROUND_COLOR = Color(0.0f, 0.0f, 0.0f, 0.5f);
+static const Color GRAPH_FAST_COLOR = Color(0.2f, 0.9f, 0.2f);
+static const Color GRAPH_SLOW_COLOR = Color(0.9f, 0.8f, 0.1f);
+static const Color GRAPH_VERY_SLOW_COLOR = Color(0.9f, 0.2f, 0.2f);
+
+namespace Geode
+{
+	PerformanceHud::PerformanceHud(Context* context, UIElement* sceneViewRoot, EditorScene::Ptr editorScene) : IView(context)
+	{
+		editorScene_ = editorScene;
+		sceneViewRoot_ = sceneViewRoot;
+		enabled_ = false;
+		numOverlayGeometries_ = 0;
+		numFrames_ = 0;
+		lastSleepTime_ = 0;
+		blockTotals_.Resize(NUM_BLOCKS);
+		blockPeaks_.Resize(NUM_BLOCKS);
+
+		// The hud lives under the ui root so it doesn't take part in the scene view layout.
+		elRoot_->SetPriority(HUD_PRIORITY);
+		elRoot_->SetVisible(false);
+
+		auto graph = elRoot_->CreateChild<BorderImage>("PerformanceHudGraph");
+		graph->SetSize(GRAPH_NUM_BARS * GRAPH_BAR_WIDTH, GRAPH_HEIGHT);
+		graph->SetColor(GRAPH_BACKGROUND_COLOR);
+		graph_ = graph;
+
+		for (unsigned i = 0; i < GRAPH_NUM_BARS; i++)
+		{
+			auto bar = graph_->CreateChild<BorderImage>();
+			bar->SetPosition(i * GRAPH_BAR_WIDTH, GRAPH_HEIGHT);
+			bar->SetSize(GRAPH_BAR_WIDTH, 0);
+			bars_.Push(bar);
+		}
+
+		statsText_ = elRoot_->CreateChild<Text>("PerformanceHudStats");
+		statsText_->SetStyleAuto();
+		statsText_->SetPosition(0, GRAPH_HEIGHT + HUD_MARGIN);
+	}
+
+	PerformanceHud::~PerformanceHud()
+	{
+		SetEnabled(false);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void PerformanceHud::SetEnabled(bool enabled)
+	{
+		if (enabled == enabled_)
+		{
+			return;
+		}
+
+		auto profiler = GetSubsystem<EditorProfiler>();
+		enabled_ = enabled;
+		elRoot_->SetVisible(enabled_);
+
+		// Timings cost nothing while nobody looks at them.
+		if (profiler != nullptr)
+		{
+			profiler->SetEnabled(enabled_);
+		}
+
+		if (enabled_)
+		{
+			for (unsigned i = 0; i < NUM_BLOCKS; i++)
+			{
+				blockTotals_[i] = 0.0f;
+				blockPeaks_[i] = 0.0f;
+			}
+
+			numFrames_ = 0;
+			lastSleepTime_ = GetSubsystem<IdleMonitor>() != nullptr ? GetSubsystem<IdleMonitor>()->GetSleepTime() : 0;
+			refreshTimer_.Reset();
+			statsText_->SetText(String::EMPTY);
+			SubscribeToEvent(E_ENDFRAME, GEODE_HANDLER(PerformanceHud, HandleEndFrame));
+		}
+		else
+		{
+			UnsubscribeFromEvent(E_ENDFRAME);
+		}
+	}
+
+	void PerformanceHud::SetNumOverlayGeometries(unsigned numOverlayGeometries)
+	{
+		numOverlayGeometries_ = numOverlayGeometries;
+	}
+
+	bool PerformanceHud::IsEnabled()
+	{
+		return enabled_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void PerformanceHud::HandleEndFrame(StringHash, VariantMap&)
+	{
+		elRoot_->SetPosition(sceneViewRoot_->GetScreenPosition() + IntVector2(HUD_MARGIN, HUD_MARGIN));
+
+		auto profiler = GetSubsystem<EditorProfiler>();
+
+		if (profiler != nullptr)
+		{
+			// Block timings are sampled every frame, text is only rebuilt on refresh to keep the ui cheap.
+			for (unsigned i = 0; i < NUM_BLOCKS; i++)
+			{
+				auto time = profiler->GetBlockTime(BLOCK_NAMES[i]);
+				blockTotals_[i] += time;
+				blockPeaks_[i] = Max(blockPeaks_[i], time);
+			}
+
+			numFrames_++;
+		}
+
+		UpdateGraph();
+
+		auto elapsed = refreshTimer_.GetMSec(false);
+
+		if (elapsed >= REFRESH_INTERVAL_MS)
+		{
+			refreshTimer_.Reset();
+			UpdateStats(elapsed);
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  UPDATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void PerformanceHud::UpdateGraph()
+	{
+		auto profiler = GetSubsystem<EditorProfiler>();
+
+		if (profiler == nullptr)
+		{
+			return;
+		}
+
+		// Newest frame on the right.
+		for (unsigned i = 0; i < GRAPH_NUM_BARS; i++)
+		{
+			auto frameTime = profiler->GetFrameTime(GRAPH_NUM_BARS - 1 - i);
+			auto height = (int)(Min(frameTime / GRAPH_MAX_FRAME_TIME, 1.0f) * GRAPH_HEIGHT);
+			auto bar = bars_[i];
+
+			bar->SetPosition(i * GRAPH_BAR_WIDTH, GRAPH_HEIGHT - height);
+			bar->SetSize(GRAPH_BAR_WIDTH, height);
+			bar->SetColor(frameTime <= TARGET_FRAME_TIME ? GRAPH_FAST_COLOR : (frameTime <= TARGET_FRAME_TIME * 2.0f ? GRAPH_SLOW_COLOR : GRAPH_VERY_SLOW_COLOR));
+		}
+	}
+
+	void PerformanceHud::UpdateStats(unsigned elapsed)
+	{
+		auto profiler = GetSubsystem<EditorProfiler>();
+		auto idleMonitor = GetSubsystem<IdleMonitor>();
+		auto renderer = GetSubsystem<Renderer>();
+		auto graphics = GetSubsystem<Graphics>();
+		String text;
+
+		if (profiler != nullptr && profiler->GetNumFrames() > 0)
+		{
+			auto numFrames = Min(profiler->GetNumFrames(), GRAPH_NUM_BARS);
+			auto totalFrameTime = 0.0f;
+			auto maxFrameTime = 0.0f;
+
+			for (unsigned i = 0; i < numFrames; i++)
+			{
+				totalFrameTime += profiler->GetFrameTime(i);
+				maxFrameTime = Max(maxFrameTime, profiler->GetFrameTime(i));
+			}
+
+			text += ToString("Frame %.2f ms (avg %.2f, max %.2f)\n", profiler->GetFrameTime(), totalFrameTime / numFrames, maxFrameTime);
+		}
+
+		if (graphics != nullptr && renderer != nullptr)
+		{
+			text += ToString("Draw calls %u, batches %u, primitives %u\n", graphics->GetNumBatches(), renderer->GetNumBatches(), renderer->GetNumPrimitives());
+			text += ToString("Geometries %u, editor overlay %u\n", renderer->GetNumGeometries(), numOverlayGeometries_);
+		}
+
+		// Walked at refresh rate only, a full scan per frame would show up in the numbers it reports.
+		PODVector<Node*> nodes;
+		editorScene_->GetChildren(nodes, true);
+		auto numComponents = editorScene_->GetNumComponents();
+
+		for (auto node : nodes)
+		{
+			numComponents += node->GetNumComponents();
+		}
+
+		text += ToString("Nodes %u, components %u\n", nodes.Size(), numComponents);
+
+		if (idleMonitor != nullptr)
+		{
+			// Share of wall time spent sleeping since the last refresh, 0% while the editor is in use.
+			auto sleepTime = idleMonitor->GetSleepTime();
+			text += ToString("Idle sleep %.0f%%\n", Min((sleepTime - lastSleepTime_) / (elapsed * 10.0f), 100.0f));
+			lastSleepTime_ = sleepTime;
+		}
+
+		for (unsigned i = 0; i < NUM_BLOCKS; i++)
+		{
+			auto average = numFrames_ > 0 ? blockTotals_[i] / numFrames_ : 0.0f;
+			text += ToString("%s %.3f ms (max %.3f)\n", BLOCK_NAMES[i], average, blockPeaks_[i]);
+			blockTotals_[i] = 0.0f;
+			blockPeaks_[i] = 0.0f;
+		}
+
+		numFrames_ = 0;
+		statsText_->SetText(text.Trimmed());
+		elRoot_->SetSize(Max(graph_->GetWidth(), statsText_->GetWidth()), statsText_->GetPosition().y_ + statsText_->GetHeight());
+	}
+}
\ No newline at end of file
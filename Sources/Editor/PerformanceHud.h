@@ -0,0 +1,62 @@
+/**
+ * @file    PerformanceHud.h
+ * @ingroup Editor
+ * @brief   Frame time graph and render statistics drawn over the scene view.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "EditorScene.h"
+#include "EditorProfiler.h"
+#include "../Gui/IView.h"
+
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/UI/Text.h>
+#include <Urho3D/UI/BorderImage.h>
+
+namespace Geode
+{
+	class PerformanceHud : public Geode::IView
+	{
+		URHO3D_OBJECT(PerformanceHud, Geode::IView)
+
+	public:
+		using Ptr = Urho3D::SharedPtr<PerformanceHud>;
+
+	public:
+		/// Constructors.
+		explicit PerformanceHud(Urho3D::Context* context, Urho3D::UIElement* sceneViewRoot, Geode::EditorScene::Ptr editorScene);
+		~PerformanceHud();
+
+		/// Accessors & Mutators.
+		void SetEnabled(bool enabled);
+		void SetNumOverlayGeometries(unsigned numOverlayGeometries);
+		bool IsEnabled();
+
+	private:
+		/// Event handlers.
+		void HandleEndFrame(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Update methods.
+		void UpdateGraph();
+		void UpdateStats(unsigned elapsed);
+
+	private:
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::UIElement* sceneViewRoot_;
+		Urho3D::Text* statsText_;
+		Urho3D::UIElement* graph_;
+		Urho3D::PODVector<Urho3D::BorderImage*> bars_;
+		bool enabled_;
+		unsigned numOverlayGeometries_;
+		unsigned numFrames_;
+		long long lastSleepTime_;
+		Urho3D::PODVector<float> blockTotals_;
+		Urho3D::PODVector<float> blockPeaks_;
+		Urho3D::Timer refreshTimer_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "PolylineSimplifier.h"
+
+#include <Urho3D/Math/MathDefs.h>
+
+using namespace Urho3D;
+
+static inline float SegmentDistanceSquared(const Vector2& point, const Vector2& a, const Vector2& b)
+{
+	auto ab = b - a;
+	auto lengthSquared = ab.LengthSquared();
+	auto t = lengthSquared > 0.0f ? Clamp((point - a).DotProduct(ab) / lengthSquared, 0.0f, 1.0f) : 0.0f;
+	return (a + ab * t - point).LengthSquared();
+}
+
+namespace Geode
+{
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void PolylineSimplifier::Simplify(const PODVector<Vector2>& points, bool closed, float maxDeviation, PODVector<Vector2>& dest)
+	{
+		auto numPoints = points.Size();
+		dest.Clear();
+
+		if (numPoints < (closed ? 4U : 3U))
+		{
+			dest = points;
+			return;
+		}
+
+		// Douglas-Peucker, bounded by the deviation rather than a vertex budget so the shape error is known.
+		// A loop is split at the point farthest from the first one and each half simplified as an open line,
+		// index numPoints standing for the first point again.
+		auto maxDeviationSquared = maxDeviation * maxDeviation;
+		PODVector<bool> keep(numPoints);
+		PODVector<IntVector2> ranges;
+
+		for (auto& kept : keep)
+		{
+			kept = false;
+		}
+
+		keep[0] = true;
+
+		if (closed)
+		{
+			auto farthest = 0U;
+			auto farthestDistance = 0.0f;
+
+			for (unsigned i = 1; i < numPoints; i++)
+			{
+				auto distance = (points[i] - points[0]).LengthSquared();
+
+				if (distance > farthestDistance)
+				{
+					farthest = i;
+					farthestDistance = distance;
+				}
+			}
+
+			keep[farthest] = true;
+			ranges.Push(IntVector2(0, farthest));
+			ranges.Push(IntVector2(farthest, numPoints));
+		}
+		else
+		{
+			keep[numPoints - 1] = true;
+			ranges.Push(IntVector2(0, numPoints - 1));
+		}
+
+		while (!ranges.Empty())
+		{
+			auto range = ranges.Back();
+			ranges.Pop();
+
+			auto& a = points[range.x_];
+			auto& b = points[range.y_ % numPoints];
+			auto split = -1;
+			auto splitDistance = maxDeviationSquared;
+
+			for (int i = range.x_ + 1; i < range.y_; i++)
+			{
+				auto distance = SegmentDistanceSquared(points[i], a, b);
+
+				if (distance > splitDistance)
+				{
+					split = i;
+					splitDistance = distance;
+				}
+			}
+
+			if (split != -1)
+			{
+				keep[split] = true;
+				ranges.Push(IntVector2(range.x_, split));
+				ranges.Push(IntVector2(split, range.y_));
+			}
+		}
+
+		for (unsigned i = 0; i < numPoints; i++)
+		{
+			if (keep[i])
+			{
+				dest.Push(points[i]);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+/**
+ * @file    PolylineSimplifier.h
+ * @ingroup Editor
+ * @brief   Vertex reduction of open and closed outlines within a maximum deviation.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Container/Vector.h>
+#include <Urho3D/Math/Vector2.h>
+
+namespace Geode
+{
+	class PolylineSimplifier
+	{
+	public:
+		/// Other methods.
+		static void Simplify(const Urho3D::PODVector<Urho3D::Vector2>& points, bool closed, float maxDeviation, Urho3D::PODVector<Urho3D::Vector2>& dest);
+	};
+}
\ No newline at end of file
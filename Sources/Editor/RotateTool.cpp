@@ -1,4 +1,5 @@
 #include "RotateTool.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/Scene/SceneEvents.h>
@@ -18,17 +19,10 @@ namespace Geode
 		radio_ = nullptr;
 		selectedNode_ = nullptr;
 		editing_ = false;
-		beginNodeRotation_ = 0;
-		currentNodeRotation_ = 0;
 
 		SetSelectedNode(editorScene_->GetSelectedNode());
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(RotateTool, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(RotateTool, HandleSelectedObjectChanged));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, URHO3D_HANDLER(RotateTool, HandleSceneViewDragBegin));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, URHO3D_HANDLER(RotateTool, HandleSceneViewDragMove));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, URHO3D_HANDLER(RotateTool, HandleSceneViewDragEnd));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, URHO3D_HANDLER(RotateTool, HandleSceneViewDragCancel));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(RotateTool, HandleSelectedObjectChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -50,7 +44,7 @@ namespace Geode
 		radio_ = toolBar->AddIconRadio("RotateToolRadio", "NodeToolRgn", "IconRotate", "Rotate");
 		EnableRadio(IsEnabled());
 
-		SubscribeToEvent(radio_, E_TOGGLED, URHO3D_HANDLER(RotateTool, HandleRadioToggled));
+		SubscribeToEvent(radio_, E_TOGGLED, GEODE_HANDLER(RotateTool, HandleRadioToggled));
 		return radio_;
 	}
 
@@ -59,13 +53,17 @@ namespace Geode
 		return IsEnabled() && radio_->IsChecked() && selectedNode_ != nullptr;
 	}
 
+	void RotateTool::Deactivate()
+	{
+		editing_ = false;
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
-	void RotateTool::HandleSceneUpdate(StringHash, VariantMap&)
+	void RotateTool::HandleEditorUpdate(StringHash, VariantMap&)
 	{
-		UpdateEditingState();
 		UpdateCursor();
 	}
 
@@ -76,14 +74,14 @@ namespace Geode
 
 	void RotateTool::HandleSceneViewDragBegin(StringHash, VariantMap&)
 	{
-		if (!IsActive() || !sceneView_->IsMouseInsideNode(selectedNode_))
+		if (!IsActive() || !sceneView_->IsMouseInsideSelection())
 		{
 			return;
 		}
 
-		currentNodeRotation_ = beginNodeRotation_ = selectedNode_->GetWorldRotation2D();
+		pivot_ = selectedNode_->GetWorldPosition2D();
 		beginMouseWorldPosition_ = sceneView_->GetMouseWorldPosition();
-		editing_ = true;
+		BeginEditing();
 	}
 
 	void RotateTool::HandleSceneViewDragMove(StringHash, VariantMap&)
@@ -94,13 +92,21 @@ namespace Geode
 		}
 
 		auto currentMouseWorldPosition = sceneView_->GetMouseWorldPosition();
-		auto nodePosition = selectedNode_->GetWorldPosition2D();
-		auto v1 = nodePosition - beginMouseWorldPosition_;
-		auto v2 = nodePosition - currentMouseWorldPosition;
+		auto v1 = pivot_ - beginMouseWorldPosition_;
+		auto v2 = pivot_ - currentMouseWorldPosition;
 
 		auto angleDelta = CalculateAngleBetween(v2, v1);
-		currentNodeRotation_ = AngleBounded(beginNodeRotation_ + angleDelta);
-		selectedNode_->SetWorldRotation2D(currentNodeRotation_);
+		auto cosAngle = Cos(angleDelta);
+		auto sinAngle = Sin(angleDelta);
+
+		// The whole selection is rotated around the primary node.
+		for (unsigned i = 0; i < editedNodes_.Size(); i++)
+		{
+			auto offset = beginTransforms_[i].position - pivot_;
+			currentTransforms_[i].rotation = AngleBounded(beginTransforms_[i].rotation + angleDelta);
+			currentTransforms_[i].position = pivot_ + Vector2(offset.x_ * cosAngle - offset.y_ * sinAngle, offset.x_ * sinAngle + offset.y_ * cosAngle);
+			TransformNodesCommand::SetWorldTransform(editedNodes_[i], currentTransforms_[i]);
+		}
 	}
 
 	void RotateTool::HandleSceneViewDragEnd(StringHash, VariantMap&)
@@ -110,7 +116,7 @@ namespace Geode
 			return;
 		}
 
-		CommandInvoker(MakeShared<RotateNodeCommand>(editorScene_, beginNodeRotation_, currentNodeRotation_), commandHistory_).Exec();
+		CommandInvoker(MakeShared<TransformNodesCommand>(editorScene_, editedNodes_, beginTransforms_, currentTransforms_), commandHistory_).Exec();
 		editing_ = false;
 	}
 
@@ -121,7 +127,7 @@ namespace Geode
 			return;
 		}
 
-		selectedNode_->SetWorldRotation2D(beginNodeRotation_);
+		TransformNodesCommand::SetWorldTransforms(editedNodes_, beginTransforms_);
 		editing_ = false;
 	}
 
@@ -140,14 +146,6 @@ namespace Geode
 	///  UPDATE METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void RotateTool::UpdateEditingState()
-	{
-		if (!IsActive())
-		{
-			editing_ = false;
-		}
-	}
-
 	void RotateTool::UpdateCursor()
 	{
 		if (!IsActive())
@@ -155,7 +153,7 @@ namespace Geode
 			return;
 		}
 
-		if (editing_ || sceneView_->IsMouseInsideNode(selectedNode_))
+		if (editing_ || sceneView_->IsMouseInsideSelection())
 		{
 			cursor_->SetShape(ACTIVE_CURSOR_SHAPE);
 		}
@@ -183,6 +181,13 @@ namespace Geode
 	///  OTHER METHODS
 	///------------------------------------------------------------------------------------------------
 
+	void RotateTool::BeginEditing()
+	{
+		TransformNodesCommand::GetSelectedWorldTransforms(editorScene_, editedNodes_, beginTransforms_);
+		currentTransforms_ = beginTransforms_;
+		editing_ = true;
+	}
+
 	void RotateTool::EnableRadio(bool enable)
 	{
 		if (radio_ == nullptr)
@@ -1,4 +1,5 @@
 #include "ScaleTool.h"
+#include "../Gui/EventProfiler.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/Input/Input.h>
@@ -22,12 +23,7 @@ namespace Geode
 		
 		SetSelectedNode(editorScene_->GetSelectedNode());
 
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(ScaleTool, HandleSceneUpdate));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(ScaleTool, HandleSelectedObjectChanged));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, URHO3D_HANDLER(ScaleTool, HandleSceneViewDragBegin));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, URHO3D_HANDLER(ScaleTool, HandleSceneViewDragMove));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, URHO3D_HANDLER(ScaleTool, HandleSceneViewDragEnd));
-		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, URHO3D_HANDLER(ScaleTool, HandleSceneViewDragCancel));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(ScaleTool, HandleSelectedObjectChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -49,7 +45,7 @@ namespace Geode
 		radio_ = toolBar->AddIconRadio("ScaleToolRadio", "NodeToolRgn", "IconScale", "Scale");
 		EnableRadio(IsEnabled());
 
-		SubscribeToEvent(radio_, E_TOGGLED, URHO3D_HANDLER(ScaleTool, HandleRadioToggled));
+		SubscribeToEvent(radio_, E_TOGGLED, GEODE_HANDLER(ScaleTool, HandleRadioToggled));
 		return radio_;
 	}
 
@@ -58,13 +54,17 @@ namespace Geode
 		return IsEnabled() && radio_->IsChecked() && selectedNode_ != nullptr;
 	}
 
+	void ScaleTool::Deactivate()
+	{
+		editing_ = false;
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
 
-	void ScaleTool::HandleSceneUpdate(StringHash, VariantMap&)
+	void ScaleTool::HandleEditorUpdate(StringHash, VariantMap&)
 	{
-		UpdateEditingState();
 		UpdateCursor();
 	}
 
@@ -75,16 +75,16 @@ namespace Geode
 
 	void ScaleTool::HandleSceneViewDragBegin(StringHash, VariantMap& eventData)
 	{
-		if (!IsActive() || !sceneView_->IsMouseInsideNode(selectedNode_))
+		if (!IsActive() || !sceneView_->IsMouseInsideSelection())
 		{
 			return;
 		}
 
 		auto mouseWorldPosition = Vector2(eventData[SceneViewDragBegin::P_X].GetFloat(), eventData[SceneViewDragBegin::P_Y].GetFloat());
 
-		currentNodeScale_ = beginNodeScale_ = selectedNode_->GetWorldScale2D();
-		baseDelta_ = selectedNode_->GetWorldPosition2D() - mouseWorldPosition;
-		editing_ = true;
+		pivot_ = selectedNode_->GetWorldPosition2D();
+		baseDelta_ = pivot_ - mouseWorldPosition;
+		BeginEditing();
 	}
 
 	void ScaleTool::HandleSceneViewDragMove(StringHash, VariantMap& eventData)
@@ -97,7 +97,7 @@ namespace Geode
 		auto input = GetSubsystem<Input>();
 
 		auto mouseWorldPosition = Vector2(eventData[SceneViewDragMove::P_X].GetFloat(), eventData[SceneViewDragMove::P_Y].GetFloat());
-		auto delta = selectedNode_->GetWorldPosition2D() - mouseWorldPosition;
+		auto delta = pivot_ - mouseWorldPosition;
 		auto factor = (delta / baseDelta_);
 
 		if (input->GetKeyDown(KEY_CTRL))
@@ -105,8 +105,13 @@ namespace Geode
 			factor.y_ = factor.x_;
 		}
 
-		currentNodeScale_ = factor * beginNodeScale_;
-		selectedNode_->SetWorldScale2D(currentNodeScale_);
+		// The whole selection is scaled around the primary node.
+		for (unsigned i = 0; i < editedNodes_.Size(); i++)
+		{
+			currentTransforms_[i].scale = factor * beginTransforms_[i].scale;
+			currentTransforms_[i].position = pivot_ + (beginTransforms_[i].position - pivot_) * factor;
+			TransformNodesCommand::SetWorldTransform(editedNodes_[i], currentTransforms_[i]);
+		}
 	}
 
 	void ScaleTool::HandleSceneViewDragEnd(StringHash, VariantMap&)
@@ -116,7 +121,7 @@ namespace Geode
 			return;
 		}
 
-		CommandInvoker(MakeShared<ScaleNodeCommand>(editorScene_, beginNodeScale_, currentNodeScale_), commandHistory_).Exec();
+		CommandInvoker(MakeShared<TransformNodesCommand>(editorScene_, editedNodes_, beginTransforms_, currentTransforms_), commandHistory_).Exec();
 		editing_ = false;
 	}
 
@@ -127,7 +132,7 @@ namespace Geode
 			return;
 		}
 
-		selectedNode_->SetWorldScale2D(beginNodeScale_);
+		TransformNodesCommand::SetWorldTransforms(editedNodes_, beginTransforms_);
 		editing_ = false;
 	}
 
@@ -146,14 +151,6 @@ namespace Geode
 	///  UPDATE METHODS
 	///------------------------------------------------------------------------------------------------
 
-	void ScaleTool::UpdateEditingState()
-	{
-		if (!IsActive())
-		{
-			editing_ = false;
-		}
-	}
-
 	void ScaleTool::UpdateCursor()
 	{
 		if (!IsActive())
@@ -161,7 +158,7 @@ namespace Geode
 			return;
 		}
 
-		if (editing_ || sceneView_->IsMouseInsideNode(selectedNode_))
+		if (editing_ || sceneView_->IsMouseInsideSelection())
 		{
 			cursor_->SetShape(ACTIVE_CURSOR_SHAPE);
 		}
@@ -189,6 +186,13 @@ namespace Geode
 	///  OTHER METHODS
 	///------------------------------------------------------------------------------------------------
 
+	void ScaleTool::BeginEditing()
+	{
+		TransformNodesCommand::GetSelectedWorldTransforms(editorScene_, editedNodes_, beginTransforms_);
+		currentTransforms_ = beginTransforms_;
+		editing_ = true;
+	}
+
 	void ScaleTool::EnableRadio(bool enable)
 	{
 		if (radio_ == nullptr)
@@ -38,25 +38,26 @@ namespace Geode
 		/// Other methods.
 		Urho3D::UIElement* PopulateToolBar(Geode::ToolBar* toolBar) override;
 		bool IsActive() override;
+		void Deactivate() override;
 
 	private:
 		/// Event handlers.
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
 		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
+		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData) override;
 		void HandleRadioToggled(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
 		/// Update methods.
-		void UpdateEditingState();
 		void UpdateCursor();
 
 		/// Accessors & Mutators.
 		void SetSelectedNode(Urho3D::Node* selectedNode);
 
 		/// Other methods.
+		void BeginEditing();
 		void EnableRadio(bool enable);
 
 	private:
@@ -67,8 +68,10 @@ namespace Geode
 		Geode::Radio* radio_;
 		Urho3D::Node* selectedNode_;
 		bool editing_;
-		Urho3D::Vector2 beginNodeScale_;
-		Urho3D::Vector2 currentNodeScale_;
+		Urho3D::PODVector<Urho3D::Node*> editedNodes_;
+		Urho3D::Vector<Geode::NodeTransform2D> beginTransforms_;
+		Urho3D::Vector<Geode::NodeTransform2D> currentTransforms_;
+		Urho3D::Vector2 pivot_;
 
 		Urho3D::Vector2 beginMouseWorldPosition_;
 
@@ -0,0 +1,224 @@
+#include "SceneGenerator.h"
+#include "CollisionShapeGeometry.h"
+
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Graphics/DebugRenderer.h>
+#include <Urho3D/Urho2D/StaticSprite2D.h>
+#include <Urho3D/Urho2D/RigidBody2D.h>
+#include <Urho3D/Urho2D/PhysicsWorld2D.h>
+#include <Urho3D/Urho2D/CollisionBox2D.h>
+#include <Urho3D/Urho2D/CollisionCircle2D.h>
+#include <Urho3D/Urho2D/CollisionPolygon2D.h>
+
+using namespace Urho3D;
+
+static const char* SPRITE_NAMES[] = { "Characters/player.png", "Characters/player2.png" };
+static const unsigned DEFAULT_SEED = 1;
+static const unsigned DEFAULT_NUM_NODES = 1000;
+static const unsigned DEFAULT_MAX_DEPTH = 1;
+static const float DEFAULT_SPACING = 2.0f;
+static const float MIN_SPRITE_SIZE = 0.25f;
+static const float MAX_SPRITE_SIZE = 2.0f;
+static const unsigned BODY_PERCENT = 40;
+static const unsigned STATIC_BODY_PERCENT = 70;
+static const unsigned BOX_PERCENT = 50;
+static const unsigned CIRCLE_PERCENT = 30;
+static const unsigned MIN_POLYGON_VERTICES = 3;
+
+namespace Geode
+{
+	SceneGenerator::SceneGenerator(Context* context) : Object(context)
+	{
+		seed_ = DEFAULT_SEED;
+		numNodes_ = DEFAULT_NUM_NODES;
+		maxDepth_ = DEFAULT_MAX_DEPTH;
+		spacing_ = DEFAULT_SPACING;
+		state_ = DEFAULT_SEED;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void SceneGenerator::SetSeed(unsigned seed)
+	{
+		seed_ = seed;
+	}
+
+	void SceneGenerator::SetNumNodes(unsigned numNodes)
+	{
+		numNodes_ = numNodes;
+	}
+
+	void SceneGenerator::SetMaxDepth(unsigned maxDepth)
+	{
+		maxDepth_ = Max(maxDepth, 1U);
+	}
+
+	void SceneGenerator::SetSpacing(float spacing)
+	{
+		spacing_ = spacing;
+	}
+
+	unsigned SceneGenerator::GetSeed() const
+	{
+		return seed_;
+	}
+
+	unsigned SceneGenerator::GetNumNodes() const
+	{
+		return numNodes_;
+	}
+
+	unsigned SceneGenerator::GetMaxDepth() const
+	{
+		return maxDepth_;
+	}
+
+	float SceneGenerator::GetSpacing() const
+	{
+		return spacing_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void SceneGenerator::Generate(Scene* scene)
+	{
+		auto cache = GetSubsystem<ResourceCache>();
+
+		sprites_.Clear();
+
+		for (auto spriteName : SPRITE_NAMES)
+		{
+			auto sprite = cache->GetResource<Sprite2D>(spriteName);
+
+			if (sprite != nullptr)
+			{
+				sprites_.Push(SharedPtr<Sprite2D>(sprite));
+			}
+		}
+
+		// Xorshift state must never be zero.
+		state_ = seed_ != 0 ? seed_ : DEFAULT_SEED;
+
+		scene->RemoveAllChildren();
+		scene->GetOrCreateComponent<Octree>();
+		scene->GetOrCreateComponent<DebugRenderer>();
+		scene->GetOrCreateComponent<PhysicsWorld2D>();
+
+		// Nodes are spread over a square so density doesn't depend on the scene size.
+		auto extent = Sqrt((float)numNodes_) * spacing_;
+		PODVector<Node*> path;
+
+		for (unsigned i = 0; i < numNodes_; i++)
+		{
+			// Pick the depth of the parent on the current branch, a max depth of 1 gives a flat scene.
+			auto level = NextRandom() % (Min(path.Size(), maxDepth_ - 1) + 1);
+			auto parent = level == 0 ? scene : path[level - 1];
+
+			path.Resize(level);
+
+			auto node = parent->CreateChild("Node" + String(i));
+			node->SetWorldPosition2D(Vector2(NextRandom(0.0f, extent), NextRandom(0.0f, extent)));
+			node->SetWorldRotation2D(NextRandom(0.0f, 360.0f));
+			path.Push(node);
+
+			CreateComponents(node);
+		}
+	}
+
+	bool SceneGenerator::Save(const String& filename)
+	{
+		auto scene = MakeShared<Scene>(context_);
+		Generate(scene);
+
+		File file(context_, filename, FILE_WRITE);
+
+		if (!file.IsOpen())
+		{
+			return false;
+		}
+
+		if (GetExtension(filename) == ".xml")
+		{
+			return scene->SaveXML(file);
+		}
+		else
+		{
+			return scene->Save(file);
+		}
+	}
+
+	void SceneGenerator::CreateComponents(Node* node)
+	{
+		auto size = NextRandom(MIN_SPRITE_SIZE, MAX_SPRITE_SIZE);
+		auto staticSprite = node->CreateComponent<StaticSprite2D>();
+
+		if (!sprites_.Empty())
+		{
+			staticSprite->SetSprite(sprites_[NextRandom() % sprites_.Size()]);
+		}
+
+		// Explicit draw rects keep node bounds meaningful in headless runs, where textures have no size.
+		staticSprite->SetUseDrawRect(true);
+		staticSprite->SetDrawRect(Rect(-size * 0.5f, -size * 0.5f, size * 0.5f, size * 0.5f));
+
+		if (NextRandom() % 100 >= BODY_PERCENT)
+		{
+			return;
+		}
+
+		auto rigidBody = node->CreateComponent<RigidBody2D>();
+		rigidBody->SetBodyType(NextRandom() % 100 < STATIC_BODY_PERCENT ? BT_STATIC : BT_DYNAMIC);
+
+		CreateCollisionShape(node, size);
+	}
+
+	void SceneGenerator::CreateCollisionShape(Node* node, float size)
+	{
+		auto shape = NextRandom() % 100;
+
+		if (shape < BOX_PERCENT)
+		{
+			node->CreateComponent<CollisionBox2D>()->SetSize(Vector2(size, size));
+		}
+		else if (shape < BOX_PERCENT + CIRCLE_PERCENT)
+		{
+			node->CreateComponent<CollisionCircle2D>()->SetRadius(size * 0.5f);
+		}
+		else
+		{
+			// Convex polygon with jittered vertices on the sprite's inscribed circle.
+			auto numVertices = MIN_POLYGON_VERTICES + NextRandom() % (CollisionShapeGeometry::MAX_POLYGON_VERTICES - MIN_POLYGON_VERTICES + 1);
+			auto step = 360.0f / numVertices;
+			PODVector<Vector2> vertices;
+
+			for (unsigned i = 0; i < numVertices; i++)
+			{
+				auto angle = step * i + NextRandom(0.0f, step * 0.5f);
+				vertices.Push(Vector2(Cos(angle), Sin(angle)) * size * 0.5f);
+			}
+
+			node->CreateComponent<CollisionPolygon2D>()->SetVertices(vertices);
+		}
+	}
+
+	unsigned SceneGenerator::NextRandom()
+	{
+		// Own generator, so the output doesn't depend on other users of Urho3D::Random.
+		state_ ^= state_ << 13;
+		state_ ^= state_ >> 17;
+		state_ ^= state_ << 5;
+		return state_;
+	}
+
+	float SceneGenerator::NextRandom(float min, float max)
+	{
+		return min + (max - min) * ((NextRandom() & 0xffffff) / (float)0x1000000);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file    SceneGenerator.h
+ * @ingroup Editor
+ * @brief   Deterministic synthetic scenes for scale testing.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Scene/Scene.h>
+#include <Urho3D/Scene/Node.h>
+#include <Urho3D/Urho2D/Sprite2D.h>
+
+namespace Geode
+{
+	class SceneGenerator : public Urho3D::Object
+	{
+		URHO3D_OBJECT(SceneGenerator, Urho3D::Object)
+
+	public:
+		using Ptr = Urho3D::SharedPtr<SceneGenerator>;
+
+	public:
+		/// Constructors.
+		explicit SceneGenerator(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetSeed(unsigned seed);
+		void SetNumNodes(unsigned numNodes);
+		void SetMaxDepth(unsigned maxDepth);
+		void SetSpacing(float spacing);
+		unsigned GetSeed() const;
+		unsigned GetNumNodes() const;
+		unsigned GetMaxDepth() const;
+		float GetSpacing() const;
+
+		/// Other methods.
+		void Generate(Urho3D::Scene* scene);
+		bool Save(const Urho3D::String& filename);
+
+	private:
+		/// Other methods.
+		void CreateComponents(Urho3D::Node* node);
+		void CreateCollisionShape(Urho3D::Node* node, float size);
+		unsigned NextRandom();
+		float NextRandom(float min, float max);
+
+	private:
+		unsigned seed_;
+		unsigned numNodes_;
+		unsigned maxDepth_;
+		float spacing_;
+		unsigned state_;
+		Urho3D::Vector<Urho3D::SharedPtr<Urho3D::Sprite2D>> sprites_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,583 @@
+#include "SceneLoader.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/IO/MemoryBuffer.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Scene/Component.h>
+#include <Urho3D/Scene/Serializable.h>
+
+#include <PugiXml/pugixml.hpp>
+
+using namespace Urho3D;
+
+static const unsigned WORK_ITEMS_PER_THREAD = 4;
+
+namespace Geode
+{
+	SceneLoader::SceneLoader(Context* context) : Object(context)
+	{
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool SceneLoader::LoadXML(Scene* scene, XMLFile* file)
+	{
+		GEODE_TRACE("SceneLoader::LoadXML", "io");
+
+		if (scene == nullptr || file == nullptr)
+		{
+			return false;
+		}
+
+		auto root = file->GetRoot("scene");
+		if (root.IsNull())
+		{
+			return false;
+		}
+
+		// Scene attributes and components are few, decode them right away.
+		NodeData rootData;
+		DecodeXMLNode(root.GetNode(), Scene::GetTypeStatic(), rootData, false);
+
+		scene->Clear();
+		InstantiateContent(scene, rootData, file);
+
+		Vector<XMLElement> sources;
+		for (auto child = root.GetChild("node"); child.NotNull(); child = child.GetNext("node"))
+		{
+			sources.Push(child);
+		}
+
+		// Chunked layout: top-level subtrees live in separate files referenced by the manifest.
+		Vector<String> chunkNames;
+		for (auto chunk = root.GetChild("chunk"); chunk.NotNull(); chunk = chunk.GetNext("chunk"))
+		{
+			chunkNames.Push(GetPath(file->GetName()) + chunk.GetAttribute("file"));
+		}
+
+		// Readable chunks are still loaded when some fail, the caller must not treat the scene as complete.
+		Vector<SharedPtr<XMLFile>> chunks;
+		auto success = LoadChunks(chunkNames, chunks);
+
+		for (auto& chunk : chunks)
+		{
+			auto chunkRoot = chunk->GetRoot("node");
+			if (chunkRoot.NotNull())
+			{
+				sources.Push(chunkRoot);
+			}
+			else
+			{
+				URHO3D_LOGERROR("Scene chunk " + chunk->GetName() + " has no root node");
+				success = false;
+			}
+		}
+
+		return LoadSubtreesXML(scene, sources) && success;
+	}
+
+	bool SceneLoader::LoadSubtreesXML(Node* parent, const Vector<XMLElement>& sources)
+	{
+		GEODE_TRACE("SceneLoader::LoadSubtreesXML", "io");
+
+		if (parent == nullptr)
+		{
+			return false;
+		}
+
+		PODVector<pugi::xml_node_struct*> xmlSources;
+		for (auto& source : sources)
+		{
+			xmlSources.Push(source.GetNode());
+		}
+
+		Vector<NodeData> results;
+		if (!DecodeXMLSubtrees(xmlSources, results))
+		{
+			return false;
+		}
+
+		for (unsigned i = 0; i < results.Size(); i++)
+		{
+			InstantiateNode(parent, results[i], sources[i].GetFile());
+		}
+
+		parent->ApplyAttributes();
+		return true;
+	}
+
+	bool SceneLoader::LoadBinary(Scene* scene, Deserializer& source)
+	{
+		GEODE_TRACE("SceneLoader::LoadBinary", "io");
+
+		if (scene == nullptr || source.ReadFileID() != "USCN")
+		{
+			return false;
+		}
+
+		PODVector<unsigned char> buffer(source.GetSize() - source.GetPosition());
+		if (buffer.Size() == 0 || source.Read(&buffer[0], buffer.Size()) != buffer.Size())
+		{
+			return false;
+		}
+
+		// Binary nodes are not size-prefixed, so subtree boundaries are only known once decoded:
+		// the whole stream is decoded by a single work item.
+		Vector<NodeData> results(1);
+
+		DecodeTask task;
+		task.loader = this;
+		task.xmlSources = nullptr;
+		task.binarySource = &buffer;
+		task.results = &results;
+		task.begin = 0;
+		task.end = 1;
+		task.success = false;
+
+		Vector<SharedPtr<WorkItem>> items;
+		items.Push(AddWorkItem(DecodeBinaryWork, &task));
+		CompleteWorkItems(items);
+
+		if (!task.success)
+		{
+			return false;
+		}
+
+		scene->Clear();
+		InstantiateContent(scene, results[0], nullptr);
+
+		for (auto& child : results[0].children)
+		{
+			InstantiateNode(scene, child, nullptr);
+		}
+
+		scene->ApplyAttributes();
+		return true;
+	}
+
+	bool SceneLoader::DecodeXMLFile(XMLFile* file, Vector<NodeData>& results) const
+	{
+		// Works on raw pugi nodes only, so it may be called from a worker thread.
+		auto root = file->GetDocument()->document_element();
+		if (!root)
+		{
+			return false;
+		}
+
+		for (auto child = root.child("node"); child; child = child.next_sibling("node"))
+		{
+			results.Resize(results.Size() + 1);
+			DecodeXMLNode(child.internal_object(), Node::GetTypeStatic(), results.Back(), true);
+		}
+
+		return true;
+	}
+
+	PODVector<Node*> SceneLoader::InstantiateSubtrees(Node* parent, const Vector<NodeData>& nodes, XMLFile* file)
+	{
+		PODVector<Node*> createdNodes;
+
+		for (auto& data : nodes)
+		{
+			createdNodes.Push(InstantiateNode(parent, data, file));
+		}
+
+		for (auto node : createdNodes)
+		{
+			node->ApplyAttributes();
+		}
+
+		return createdNodes;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  WORK FUNCTIONS
+	///------------------------------------------------------------------------------------------------
+
+	void SceneLoader::DecodeXMLWork(const WorkItem* item, unsigned)
+	{
+		auto task = static_cast<DecodeTask*>(item->aux_);
+
+		for (unsigned i = task->begin; i < task->end; i++)
+		{
+			task->loader->DecodeXMLNode(task->xmlSources->At(i), Node::GetTypeStatic(), task->results->At(i), true);
+		}
+
+		task->success = true;
+	}
+
+	void SceneLoader::DecodeBinaryWork(const WorkItem* item, unsigned)
+	{
+		auto task = static_cast<DecodeTask*>(item->aux_);
+
+		MemoryBuffer source(*task->binarySource);
+		task->success = task->loader->DecodeBinaryNode(source, Scene::GetTypeStatic(), task->results->At(0));
+	}
+
+	void SceneLoader::LoadChunkWork(const WorkItem* item, unsigned)
+	{
+		auto task = static_cast<ChunkTask*>(item->aux_);
+		auto cache = task->file->GetSubsystem<ResourceCache>();
+
+		// Same path as the resource cache background loader: file access and parsing are thread-safe.
+		auto source = cache->GetFile(task->name, false);
+		task->success = source != nullptr && task->file->Load(*source);
+	}
+
+	SharedPtr<WorkItem> SceneLoader::AddWorkItem(void (*workFunction)(const WorkItem*, unsigned), void* aux)
+	{
+		// Not taken from the work queue pool: the item is polled until completion and must not be recycled meanwhile.
+		auto item = MakeShared<WorkItem>();
+		item->workFunction_ = workFunction;
+		item->aux_ = aux;
+		item->priority_ = M_MAX_UNSIGNED;
+
+		GetSubsystem<WorkQueue>()->AddWorkItem(item);
+		return item;
+	}
+
+	void SceneLoader::CompleteWorkItems(const Vector<SharedPtr<WorkItem>>& items)
+	{
+		auto workQueue = GetSubsystem<WorkQueue>();
+
+		// Only this batch is waited for, unrelated background work keeps its place in the queue.
+		for (auto& item : items)
+		{
+			while (!item->completed_)
+			{
+				// Not picked up by a worker yet: run it right here.
+				if (workQueue->RemoveWorkItem(item))
+				{
+					item->workFunction_(item, 0);
+					break;
+				}
+
+				Time::Sleep(0);
+			}
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  CHUNK METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool SceneLoader::LoadChunks(const Vector<String>& names, Vector<SharedPtr<XMLFile>>& dest)
+	{
+		GEODE_TRACE("SceneLoader::LoadChunks", "io");
+
+		Vector<ChunkTask> tasks(names.Size());
+		Vector<SharedPtr<XMLFile>> chunks;
+		Vector<SharedPtr<WorkItem>> items;
+
+		for (unsigned i = 0; i < names.Size(); i++)
+		{
+			auto chunk = MakeShared<XMLFile>(context_);
+			chunks.Push(chunk);
+
+			auto& task = tasks[i];
+			task.name = names[i];
+			task.file = chunk;
+			task.success = false;
+
+			items.Push(AddWorkItem(LoadChunkWork, &task));
+		}
+
+		CompleteWorkItems(items);
+
+		auto success = true;
+		dest.Clear();
+
+		for (unsigned i = 0; i < tasks.Size(); i++)
+		{
+			if (tasks[i].success)
+			{
+				chunks[i]->SetName(tasks[i].name);
+				dest.Push(chunks[i]);
+			}
+			else
+			{
+				URHO3D_LOGERROR("Failed to load scene chunk " + tasks[i].name);
+				success = false;
+			}
+		}
+
+		return success;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  DECODE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool SceneLoader::DecodeXMLSubtrees(const PODVector<pugi::xml_node_struct*>& sources, Vector<NodeData>& results)
+	{
+		GEODE_TRACE("SceneLoader::DecodeXMLSubtrees", "io");
+
+		results.Resize(sources.Size());
+
+		if (sources.Empty())
+		{
+			return true;
+		}
+
+		auto workQueue = GetSubsystem<WorkQueue>();
+		auto numItems = Min(sources.Size(), Max(workQueue->GetNumThreads(), 1U) * WORK_ITEMS_PER_THREAD);
+
+		Vector<DecodeTask> tasks(numItems);
+		Vector<SharedPtr<WorkItem>> items;
+
+		for (unsigned i = 0; i < numItems; i++)
+		{
+			auto& task = tasks[i];
+			task.loader = this;
+			task.xmlSources = &sources;
+			task.binarySource = nullptr;
+			task.results = &results;
+			task.begin = i * sources.Size() / numItems;
+			task.end = (i + 1) * sources.Size() / numItems;
+			task.success = false;
+
+			items.Push(AddWorkItem(DecodeXMLWork, &task));
+		}
+
+		CompleteWorkItems(items);
+
+		for (auto& task : tasks)
+		{
+			if (!task.success)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void SceneLoader::DecodeXMLNode(pugi::xml_node_struct* source, StringHash type, NodeData& data, bool readChildren) const
+	{
+		pugi::xml_node node(source);
+
+		data.id = node.attribute("id").as_uint();
+		DecodeXMLAttributes(source, type, data.attributes);
+
+		for (auto componentNode = node.child("component"); componentNode; componentNode = componentNode.next_sibling("component"))
+		{
+			ComponentData component;
+			component.type = StringHash(componentNode.attribute("type").value());
+			component.id = componentNode.attribute("id").as_uint();
+			data.components.Push(component);
+
+			DecodeXMLAttributes(componentNode.internal_object(), component.type, data.components.Back().attributes);
+		}
+
+		if (!readChildren)
+		{
+			return;
+		}
+
+		for (auto childNode = node.child("node"); childNode; childNode = childNode.next_sibling("node"))
+		{
+			data.children.Resize(data.children.Size() + 1);
+			DecodeXMLNode(childNode.internal_object(), Node::GetTypeStatic(), data.children.Back(), true);
+		}
+	}
+
+	void SceneLoader::DecodeXMLAttributes(pugi::xml_node_struct* source, StringHash type, Vector<AttributeData>& attributes) const
+	{
+		auto infos = context_->GetAttributes(type);
+		if (infos == nullptr || infos->Empty())
+		{
+			return;
+		}
+
+		// Attributes are usually stored in registration order, so resume the search after the last match.
+		unsigned startIndex = 0;
+
+		for (auto attributeNode = pugi::xml_node(source).child("attribute"); attributeNode; attributeNode = attributeNode.next_sibling("attribute"))
+		{
+			auto name = attributeNode.attribute("name").value();
+			auto index = startIndex;
+			auto found = false;
+
+			do
+			{
+				auto& info = infos->At(index);
+				if ((info.mode_ & AM_FILE) && info.name_ == name)
+				{
+					found = true;
+					break;
+				}
+
+				index = (index + 1) % infos->Size();
+			} while (index != startIndex);
+
+			if (!found)
+			{
+				continue;
+			}
+
+			auto& info = infos->At(index);
+			startIndex = (index + 1) % infos->Size();
+
+			AttributeData attribute;
+			attribute.index = index;
+			attribute.xmlSource = nullptr;
+
+			if (info.enumNames_)
+			{
+				String value(attributeNode.attribute("value").value());
+				int enumValue = 0;
+				auto enumPtr = info.enumNames_;
+
+				while (*enumPtr && value.Compare(*enumPtr, false) != 0)
+				{
+					enumPtr++;
+					enumValue++;
+				}
+
+				if (*enumPtr == nullptr)
+				{
+					continue;
+				}
+
+				attribute.value = enumValue;
+			}
+			else if (info.type_ == VAR_VARIANTVECTOR || info.type_ == VAR_STRINGVECTOR || info.type_ == VAR_VARIANTMAP)
+			{
+				// Nested values are read through XMLElement, which is not safe off the main thread.
+				attribute.xmlSource = attributeNode.internal_object();
+			}
+			else
+			{
+				attribute.value.FromString(info.type_, attributeNode.attribute("value").value());
+			}
+
+			attributes.Push(attribute);
+		}
+	}
+
+	bool SceneLoader::DecodeBinaryNode(Deserializer& source, StringHash type, NodeData& data) const
+	{
+		data.id = source.ReadUInt();
+
+		if (!DecodeBinaryAttributes(source, type, data.attributes))
+		{
+			return false;
+		}
+
+		auto numComponents = source.ReadVLE();
+		for (unsigned i = 0; i < numComponents; i++)
+		{
+			auto size = source.ReadVLE();
+			auto start = source.GetPosition();
+
+			ComponentData component;
+			component.type = source.ReadStringHash();
+			component.id = source.ReadUInt();
+			data.components.Push(component);
+
+			// Unknown component types are skipped through their size prefix.
+			DecodeBinaryAttributes(source, component.type, data.components.Back().attributes);
+			source.Seek(start + size);
+		}
+
+		auto numChildren = source.ReadVLE();
+		data.children.Resize(numChildren);
+
+		for (unsigned i = 0; i < numChildren; i++)
+		{
+			if (source.IsEof() || !DecodeBinaryNode(source, Node::GetTypeStatic(), data.children[i]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool SceneLoader::DecodeBinaryAttributes(Deserializer& source, StringHash type, Vector<AttributeData>& attributes) const
+	{
+		auto infos = context_->GetAttributes(type);
+		if (infos == nullptr)
+		{
+			return false;
+		}
+
+		for (unsigned i = 0; i < infos->Size(); i++)
+		{
+			auto& info = infos->At(i);
+			if (!(info.mode_ & AM_FILE))
+			{
+				continue;
+			}
+
+			if (source.IsEof())
+			{
+				return false;
+			}
+
+			AttributeData attribute;
+			attribute.index = i;
+			attribute.value = source.ReadVariant(info.type_);
+			attribute.xmlSource = nullptr;
+			attributes.Push(attribute);
+		}
+
+		return true;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  INSTANTIATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	Node* SceneLoader::InstantiateNode(Node* parent, const NodeData& data, XMLFile* file)
+	{
+		auto node = parent->CreateChild(data.id, data.id < FIRST_LOCAL_ID ? REPLICATED : LOCAL);
+		InstantiateContent(node, data, file);
+
+		for (auto& child : data.children)
+		{
+			InstantiateNode(node, child, file);
+		}
+
+		return node;
+	}
+
+	void SceneLoader::InstantiateContent(Node* node, const NodeData& data, XMLFile* file)
+	{
+		ApplyAttributes(node, data.attributes, file);
+
+		for (auto& componentData : data.components)
+		{
+			auto component = node->CreateComponent(componentData.type, componentData.id < FIRST_LOCAL_ID ? REPLICATED : LOCAL, componentData.id);
+			if (component != nullptr)
+			{
+				ApplyAttributes(component, componentData.attributes, file);
+			}
+		}
+	}
+
+	void SceneLoader::ApplyAttributes(Serializable* serializable, const Vector<AttributeData>& attributes, XMLFile* file)
+	{
+		auto infos = serializable->GetAttributes();
+
+		for (auto& attribute : attributes)
+		{
+			if (attribute.xmlSource != nullptr)
+			{
+				XMLElement element(file, attribute.xmlSource);
+				serializable->SetAttribute(attribute.index, element.GetVariantValue(infos->At(attribute.index).type_));
+			}
+			else
+			{
+				serializable->SetAttribute(attribute.index, attribute.value);
+			}
+		}
+	}
+}
\ No newline at end of file
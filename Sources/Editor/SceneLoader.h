@@ -0,0 +1,104 @@
+/**
+ * @file    SceneLoader.h
+ * @ingroup Editor
+ * @brief   Scene loader which decodes top-level subtrees on worker threads.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/Variant.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Scene/Scene.h>
+#include <Urho3D/Scene/Node.h>
+#include <Urho3D/Resource/XMLFile.h>
+#include <Urho3D/Resource/XMLElement.h>
+#include <Urho3D/IO/Deserializer.h>
+
+namespace pugi
+{
+	struct xml_node_struct;
+}
+
+namespace Geode
+{
+	class SceneLoader : public Urho3D::Object
+	{
+		URHO3D_OBJECT(SceneLoader, Urho3D::Object)
+
+	public:
+		struct AttributeData {
+			unsigned index;
+			Urho3D::Variant value;
+			pugi::xml_node_struct* xmlSource;
+		};
+
+		struct ComponentData {
+			Urho3D::StringHash type;
+			unsigned id;
+			Urho3D::Vector<AttributeData> attributes;
+		};
+
+		struct NodeData {
+			unsigned id;
+			Urho3D::Vector<AttributeData> attributes;
+			Urho3D::Vector<ComponentData> components;
+			Urho3D::Vector<NodeData> children;
+		};
+
+	private:
+		struct DecodeTask {
+			const SceneLoader* loader;
+			const Urho3D::PODVector<pugi::xml_node_struct*>* xmlSources;
+			const Urho3D::PODVector<unsigned char>* binarySource;
+			Urho3D::Vector<NodeData>* results;
+			unsigned begin;
+			unsigned end;
+			bool success;
+		};
+
+		struct ChunkTask {
+			Urho3D::String name;
+			Urho3D::XMLFile* file;
+			bool success;
+		};
+
+	public:
+		/// Constructors.
+		explicit SceneLoader(Urho3D::Context* context);
+
+		/// Other methods.
+		bool LoadXML(Urho3D::Scene* scene, Urho3D::XMLFile* file);
+		bool LoadSubtreesXML(Urho3D::Node* parent, const Urho3D::Vector<Urho3D::XMLElement>& sources);
+		bool LoadBinary(Urho3D::Scene* scene, Urho3D::Deserializer& source);
+		bool DecodeXMLFile(Urho3D::XMLFile* file, Urho3D::Vector<NodeData>& results) const;
+		Urho3D::PODVector<Urho3D::Node*> InstantiateSubtrees(Urho3D::Node* parent, const Urho3D::Vector<NodeData>& nodes, Urho3D::XMLFile* file);
+
+	private:
+		/// Work functions.
+		static void DecodeXMLWork(const Urho3D::WorkItem* item, unsigned threadIndex);
+		static void DecodeBinaryWork(const Urho3D::WorkItem* item, unsigned threadIndex);
+		static void LoadChunkWork(const Urho3D::WorkItem* item, unsigned threadIndex);
+		Urho3D::SharedPtr<Urho3D::WorkItem> AddWorkItem(void (*workFunction)(const Urho3D::WorkItem*, unsigned), void* aux);
+		void CompleteWorkItems(const Urho3D::Vector<Urho3D::SharedPtr<Urho3D::WorkItem>>& items);
+
+		/// Chunk methods.
+		bool LoadChunks(const Urho3D::Vector<Urho3D::String>& names, Urho3D::Vector<Urho3D::SharedPtr<Urho3D::XMLFile>>& dest);
+
+		/// Decode methods (thread-safe).
+		bool DecodeXMLSubtrees(const Urho3D::PODVector<pugi::xml_node_struct*>& sources, Urho3D::Vector<NodeData>& results);
+		void DecodeXMLNode(pugi::xml_node_struct* source, Urho3D::StringHash type, NodeData& data, bool readChildren) const;
+		void DecodeXMLAttributes(pugi::xml_node_struct* source, Urho3D::StringHash type, Urho3D::Vector<AttributeData>& attributes) const;
+		bool DecodeBinaryNode(Urho3D::Deserializer& source, Urho3D::StringHash type, NodeData& data) const;
+		bool DecodeBinaryAttributes(Urho3D::Deserializer& source, Urho3D::StringHash type, Urho3D::Vector<AttributeData>& attributes) const;
+
+		/// Instantiate methods (main thread).
+		Urho3D::Node* InstantiateNode(Urho3D::Node* parent, const NodeData& data, Urho3D::XMLFile* file);
+		void InstantiateContent(Urho3D::Node* node, const NodeData& data, Urho3D::XMLFile* file);
+		void ApplyAttributes(Urho3D::Serializable* serializable, const Urho3D::Vector<AttributeData>& attributes, Urho3D::XMLFile* file);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include "SceneSnapshot.h"
+#include "../Gui/TraceRecorder.h"
+
+#include <Urho3D/Core/Attribute.h>
+#include <Urho3D/Scene/Component.h>
+
+using namespace Urho3D;
+
+namespace Geode
+{
+	SceneSnapshot::SceneSnapshot(Context* context) : Object(context)
+	{
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	Scene* SceneSnapshot::GetScene() const
+	{
+		return scene_;
+	}
+
+	unsigned SceneSnapshot::GetNumNodes() const
+	{
+		return nodes_.Size();
+	}
+
+	unsigned SceneSnapshot::GetNumComponents() const
+	{
+		return componentTypes_.Size();
+	}
+
+	bool SceneSnapshot::IsEmpty() const
+	{
+		return nodes_.Empty();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void SceneSnapshot::Capture(Scene* scene)
+	{
+		GEODE_TRACE("SceneSnapshot::Capture", "io");
+
+		Clear();
+
+		if (scene == nullptr)
+		{
+			return;
+		}
+
+		scene_ = scene;
+		CaptureNode(scene, 0, 0);
+	}
+
+	bool SceneSnapshot::Restore(Scene* scene) const
+	{
+		GEODE_TRACE("SceneSnapshot::Restore", "io");
+
+		if (scene == nullptr || scene != scene_ || nodes_.Empty())
+		{
+			return false;
+		}
+
+		// Objects created since the capture go first, ids of the restored ones stay free.
+		RemoveStaleObjects(scene);
+
+		PODVector<Component*> changedComponents;
+		Node* holder = nullptr;
+
+		// Parents are stored before their children, so they exist by the time a child is restored.
+		for (auto& state : nodes_)
+		{
+			auto node = state.parentId == 0 ? scene : scene->GetNode(state.id);
+			auto parent = state.parentId == 0 ? nullptr : scene->GetNode(state.parentId);
+
+			if (node == nullptr)
+			{
+				node = parent->CreateChild(String::EMPTY, state.id < FIRST_LOCAL_ID ? REPLICATED : LOCAL, state.id);
+			}
+			else if (parent != nullptr && node->GetParent() != parent)
+			{
+				node->SetParent(parent);
+			}
+
+			// Recreated and reparented nodes come last, siblings are visited in order so each one moves back in place.
+			if (parent != nullptr)
+			{
+				auto& siblings = parent->GetChildren();
+				auto index = Min(state.index, siblings.Size() - 1);
+
+				if (siblings[index].Get() != node)
+				{
+					// Removing would drop the subtree ids, moving out through a holder keeps them registered.
+					if (holder == nullptr)
+					{
+						holder = scene->CreateChild(String::EMPTY, LOCAL);
+						holder->SetTemporary(true);
+					}
+
+					holder->AddChild(node);
+					parent->AddChild(node, index);
+				}
+			}
+
+			RestoreAttributes(node, state.attributes);
+
+			for (auto& componentState : state.components)
+			{
+				auto component = scene->GetComponent(componentState.id);
+
+				if (component == nullptr)
+				{
+					component = node->CreateComponent(componentState.type, componentState.id < FIRST_LOCAL_ID ? REPLICATED : LOCAL, componentState.id);
+				}
+
+				if (component != nullptr && RestoreAttributes(component, componentState.attributes))
+				{
+					changedComponents.Push(component);
+				}
+			}
+		}
+
+		if (holder != nullptr)
+		{
+			holder->Remove();
+		}
+
+		// Node attributes apply on set, and Node::ApplyAttributes would walk the whole subtree.
+		for (auto component : changedComponents)
+		{
+			component->ApplyAttributes();
+		}
+
+		return true;
+	}
+
+	void SceneSnapshot::Clear()
+	{
+		scene_.Reset();
+		nodes_.Clear();
+		nodeIds_.Clear();
+		componentTypes_.Clear();
+	}
+
+	void SceneSnapshot::CaptureNode(Node* node, unsigned parentId, unsigned index)
+	{
+		// Temporary objects (editor helpers) are neither saved nor restored.
+		if (node->IsTemporary())
+		{
+			return;
+		}
+
+		nodes_.Resize(nodes_.Size() + 1);
+
+		auto& state = nodes_.Back();
+		state.id = node->GetID();
+		state.parentId = parentId;
+		state.index = index;
+		CaptureAttributes(node, state.attributes);
+		nodeIds_.Insert(state.id);
+
+		for (auto& component : node->GetComponents())
+		{
+			if (component->IsTemporary())
+			{
+				continue;
+			}
+
+			ComponentState componentState;
+			componentState.type = component->GetType();
+			componentState.id = component->GetID();
+			CaptureAttributes(component, componentState.attributes);
+			componentTypes_[componentState.id] = componentState.type;
+			state.components.Push(componentState);
+		}
+
+		// The state reference is invalidated once children are pushed.
+		auto& children = node->GetChildren();
+
+		for (unsigned i = 0; i < children.Size(); i++)
+		{
+			CaptureNode(children[i], node->GetID(), i);
+		}
+	}
+
+	void SceneSnapshot::RemoveStaleObjects(Node* node) const
+	{
+		auto& components = node->GetComponents();
+
+		for (auto i = components.Size(); i-- > 0;)
+		{
+			auto component = components[i].Get();
+			auto typeIt = componentTypes_.Find(component->GetID());
+
+			if (!component->IsTemporary() && (typeIt == componentTypes_.End() || typeIt->second_ != component->GetType()))
+			{
+				node->RemoveComponent(component);
+			}
+		}
+
+		auto& children = node->GetChildren();
+
+		for (auto i = children.Size(); i-- > 0;)
+		{
+			auto child = children[i].Get();
+
+			if (child->IsTemporary())
+			{
+				continue;
+			}
+
+			if (nodeIds_.Contains(child->GetID()))
+			{
+				RemoveStaleObjects(child);
+			}
+			else
+			{
+				node->RemoveChild(child);
+			}
+		}
+	}
+
+	void SceneSnapshot::CaptureAttributes(Serializable* serializable, Vector<Variant>& dest)
+	{
+		auto attributes = serializable->GetAttributes();
+
+		if (attributes == nullptr)
+		{
+			return;
+		}
+
+		dest.Reserve(attributes->Size());
+
+		// Same attributes as a file save, network only ones are left out.
+		for (unsigned i = 0; i < attributes->Size(); i++)
+		{
+			if ((*attributes)[i].mode_ & AM_FILE)
+			{
+				dest.Push(serializable->GetAttribute(i));
+			}
+		}
+	}
+
+	bool SceneSnapshot::RestoreAttributes(Serializable* serializable, const Vector<Variant>& values)
+	{
+		auto attributes = serializable->GetAttributes();
+		auto changed = false;
+		unsigned valueIndex = 0;
+
+		if (attributes == nullptr)
+		{
+			return false;
+		}
+
+		for (unsigned i = 0; i < attributes->Size() && valueIndex < values.Size(); i++)
+		{
+			if (!((*attributes)[i].mode_ & AM_FILE))
+			{
+				continue;
+			}
+
+			auto& value = values[valueIndex++];
+
+			// Most attributes are untouched by a preview, comparing is much cheaper than setting.
+			if (serializable->GetAttribute(i) != value)
+			{
+				serializable->SetAttribute(i, value);
+				changed = true;
+			}
+		}
+
+		return changed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @file    SceneSnapshot.h
+ * @ingroup Editor
+ * @brief   In-memory copy of the scene attributes, restored in place by reapplying what differs.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Container/HashSet.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace Geode
+{
+	class SceneSnapshot : public Urho3D::Object
+	{
+		URHO3D_OBJECT(SceneSnapshot, Urho3D::Object)
+
+		struct ComponentState {
+			Urho3D::StringHash type;
+			unsigned id;
+			Urho3D::Vector<Urho3D::Variant> attributes;
+		};
+
+		struct NodeState {
+			unsigned id;
+			unsigned parentId;
+			unsigned index;
+			Urho3D::Vector<Urho3D::Variant> attributes;
+			Urho3D::Vector<ComponentState> components;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<SceneSnapshot>;
+
+	public:
+		/// Constructors.
+		explicit SceneSnapshot(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		Urho3D::Scene* GetScene() const;
+		unsigned GetNumNodes() const;
+		unsigned GetNumComponents() const;
+		bool IsEmpty() const;
+
+		/// Other methods.
+		void Capture(Urho3D::Scene* scene);
+		bool Restore(Urho3D::Scene* scene) const;
+		void Clear();
+
+	private:
+		/// Other methods.
+		void CaptureNode(Urho3D::Node* node, unsigned parentId, unsigned index);
+		void RemoveStaleObjects(Urho3D::Node* node) const;
+		static void CaptureAttributes(Urho3D::Serializable* serializable, Urho3D::Vector<Urho3D::Variant>& dest);
+		static bool RestoreAttributes(Urho3D::Serializable* serializable, const Urho3D::Vector<Urho3D::Variant>& values);
+
+	private:
+		Urho3D::WeakPtr<Urho3D::Scene> scene_;
+		Urho3D::Vector<NodeState> nodes_;
+		Urho3D::HashSet<unsigned> nodeIds_;
+		Urho3D::HashMap<unsigned, Urho3D::StringHash> componentTypes_;
+	};
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "SceneView.h"
 #include "SceneViewEvents.h"
+#include "../Gui/EventProfiler.h"
+#include "../Gui/TraceRecorder.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/UI/UIEvents.h>
@@ -15,6 +17,9 @@ using namespace Urho3D;
 
 static const float CAMERA_MOVE_SPEED = 10.f;
 static const float CAMERA_DISTANCE = -10.f;
+static const float MARQUEE_MIN_SIZE = 4.f * PIXEL_SIZE;
+static const Color MARQUEE_COLOR = Color(1.f, 1.f, 1.f);
+static const Color MARQUEE_HIGHLIGHT_COLOR = Color(0.f, 0.8f, 1.f);
 
 namespace Geode
 {
@@ -24,6 +29,11 @@ namespace Geode
 		debugGeometryEnabled_ = true;
 		nodeSelectionEnabled_ = true;
 		dragging_ = false;
+		inputCoalescingEnabled_ = true;
+		dragMovePending_ = false;
+		dragMoveButtons_ = 0;
+		dragMoveQualifiers_ = 0;
+		marqueeSelecting_ = false;
 
 		// Init camera.
 		// ----------------------------------------------------------------------------------------------------------------
@@ -58,15 +68,23 @@ namespace Geode
 		// ----------------------------------------------------------------------------------------------------------------
 		grid_ = MakeShared<Grid>(context_, editorScene_);
 
+		// Init performance hud.
+		// ----------------------------------------------------------------------------------------------------------------
+		performanceHud_ = MakeShared<PerformanceHud>(context_, elRoot_, editorScene_);
+
 		// Init all events.
 		// ----------------------------------------------------------------------------------------------------------------
-		SubscribeToEvent(elRoot_, E_RESIZED, URHO3D_HANDLER(SceneView, HandleResized));
-		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, URHO3D_HANDLER(SceneView, HandleSelectedObjectChanged));
-		SubscribeToEvent(editorScene_, E_SCENEUPDATE, URHO3D_HANDLER(SceneView, HandleSceneUpdate));
-		SubscribeToEvent(E_POSTRENDERUPDATE, URHO3D_HANDLER(SceneView, HandleScenePostRender));
-		SubscribeToEvent(E_MOUSEBUTTONDOWN, URHO3D_HANDLER(SceneView, HandleMouseButtonDown));
-		SubscribeToEvent(E_MOUSEMOVE, URHO3D_HANDLER(SceneView, HandleMouseMove));
-		SubscribeToEvent(E_MOUSEBUTTONUP, URHO3D_HANDLER(SceneView, HandleMouseButtonUp));
+		SubscribeToEvent(elRoot_, E_RESIZED, GEODE_HANDLER(SceneView, HandleResized));
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(SceneView, HandleSelectedObjectChanged));
+		SubscribeToEvent(editorScene_, E_EDITORUPDATE, GEODE_HANDLER(SceneView, HandleEditorUpdate));
+		SubscribeToEvent(E_POSTRENDERUPDATE, GEODE_HANDLER(SceneView, HandleScenePostRender));
+		SubscribeToEvent(E_MOUSEBUTTONDOWN, GEODE_HANDLER(SceneView, HandleMouseButtonDown));
+		SubscribeToEvent(E_MOUSEMOVE, GEODE_HANDLER(SceneView, HandleMouseMove));
+		SubscribeToEvent(E_MOUSEBUTTONUP, GEODE_HANDLER(SceneView, HandleMouseButtonUp));
+		SubscribeToEvent(this, E_SCENEVIEW_DRAGBEGIN, GEODE_HANDLER(SceneView, HandleSceneViewDragBegin));
+		SubscribeToEvent(this, E_SCENEVIEW_DRAGMOVE, GEODE_HANDLER(SceneView, HandleSceneViewDragMove));
+		SubscribeToEvent(this, E_SCENEVIEW_DRAGEND, GEODE_HANDLER(SceneView, HandleSceneViewDragEnd));
+		SubscribeToEvent(this, E_SCENEVIEW_DRAGCANCEL, GEODE_HANDLER(SceneView, HandleSceneViewDragCancel));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -99,6 +117,25 @@ namespace Geode
 		grid_->SetEnabled(enabled);
 	}
 
+	void SceneView::SetPerformanceHudEnabled(bool enabled)
+	{
+		performanceHud_->SetEnabled(enabled);
+	}
+
+	void SceneView::SetInputCoalescingEnabled(bool enabled)
+	{
+		if (enabled != inputCoalescingEnabled_)
+		{
+			FlushDragMove();
+			inputCoalescingEnabled_ = enabled;
+		}
+	}
+
+	void SceneView::SetCameraPosition(const Vector2& position)
+	{
+		cameraNode_->SetPosition(Vector3(position, CAMERA_DISTANCE));
+	}
+
 	EditorScene::Ptr SceneView::GetEditorScene()
 	{
 		return editorScene_;
@@ -124,6 +161,16 @@ namespace Geode
 		return grid_->IsEnabled();
 	}
 
+	bool SceneView::GetPerformanceHudEnabled()
+	{
+		return performanceHud_->IsEnabled();
+	}
+
+	bool SceneView::GetInputCoalescingEnabled()
+	{
+		return inputCoalescingEnabled_;
+	}
+
 	Vector2 SceneView::GetMouseMove()
 	{
 		return mouseWorldMove_;
@@ -186,6 +233,12 @@ namespace Geode
 		return nodeRect.IsInside(mouseWorldPosition);
 	}
 
+	bool SceneView::IsMouseInsideSelection()
+	{
+		// Polled every frame by the tools, the picking index answers without walking the selection.
+		return editorScene_->GetSelectedNodeAt(GetMouseWorldPosition()) != nullptr;
+	}
+
 	bool SceneView::IsMouseInsideViewport()
 	{
 		auto ui = GetSubsystem<UI>();
@@ -195,6 +248,59 @@ namespace Geode
 		return viewportRect.IsInside(mousePosition);
 	}
 
+	void SceneView::SendDragMove(StringHash eventType)
+	{
+		auto mouseWorldPosition = GetMouseWorldPosition();
+		auto dragMouseDelta = mouseWorldPosition - beginDragMouseWorldPosition_;
+
+		VariantMap& sendEventData = GetEventDataMap();
+		sendEventData[SceneViewDragMove::P_X] = mouseWorldPosition.x_;
+		sendEventData[SceneViewDragMove::P_Y] = mouseWorldPosition.y_;
+		sendEventData[SceneViewDragMove::P_DX] = dragMouseDelta.x_;
+		sendEventData[SceneViewDragMove::P_DY] = dragMouseDelta.y_;
+		sendEventData[SceneViewDragMove::P_BUTTONS] = dragMoveButtons_;
+		sendEventData[SceneViewDragMove::P_QUALIFIERS] = dragMoveQualifiers_;
+		SendEvent(eventType, sendEventData);
+	}
+
+	void SceneView::FlushDragMove()
+	{
+		if (dragMovePending_)
+		{
+			dragMovePending_ = false;
+			SendDragMove(E_SCENEVIEW_DRAGMOVE);
+		}
+	}
+
+	Rect SceneView::GetMarqueeRect() const
+	{
+		return Rect(VectorMin(marqueeBegin_, marqueeEnd_), VectorMax(marqueeBegin_, marqueeEnd_));
+	}
+
+	void SceneView::DrawMarquee(DebugRenderer* debugRenderer)
+	{
+		GEODE_TRACE("SceneView::DrawMarquee", "overlay");
+
+		auto rect = GetMarqueeRect();
+
+		// Queried once per rendered frame, however many mouse moves happened since the last one.
+		editorScene_->GetNodesInRect(marqueeNodes_, rect);
+
+		for (auto node : marqueeNodes_)
+		{
+			auto nodeRect = editorScene_->GetNodeWorldRect(node);
+			debugRenderer->AddLine(Vector3(nodeRect.min_.x_, nodeRect.min_.y_, 0), Vector3(nodeRect.max_.x_, nodeRect.min_.y_, 0), MARQUEE_HIGHLIGHT_COLOR, false);
+			debugRenderer->AddLine(Vector3(nodeRect.max_.x_, nodeRect.min_.y_, 0), Vector3(nodeRect.max_.x_, nodeRect.max_.y_, 0), MARQUEE_HIGHLIGHT_COLOR, false);
+			debugRenderer->AddLine(Vector3(nodeRect.max_.x_, nodeRect.max_.y_, 0), Vector3(nodeRect.min_.x_, nodeRect.max_.y_, 0), MARQUEE_HIGHLIGHT_COLOR, false);
+			debugRenderer->AddLine(Vector3(nodeRect.min_.x_, nodeRect.max_.y_, 0), Vector3(nodeRect.min_.x_, nodeRect.min_.y_, 0), MARQUEE_HIGHLIGHT_COLOR, false);
+		}
+
+		debugRenderer->AddLine(Vector3(rect.min_.x_, rect.min_.y_, 0), Vector3(rect.max_.x_, rect.min_.y_, 0), MARQUEE_COLOR, false);
+		debugRenderer->AddLine(Vector3(rect.max_.x_, rect.min_.y_, 0), Vector3(rect.max_.x_, rect.max_.y_, 0), MARQUEE_COLOR, false);
+		debugRenderer->AddLine(Vector3(rect.max_.x_, rect.max_.y_, 0), Vector3(rect.min_.x_, rect.max_.y_, 0), MARQUEE_COLOR, false);
+		debugRenderer->AddLine(Vector3(rect.min_.x_, rect.max_.y_, 0), Vector3(rect.min_.x_, rect.min_.y_, 0), MARQUEE_COLOR, false);
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  EVENT HANDLERS
 	///------------------------------------------------------------------------------------------------
@@ -211,11 +317,16 @@ namespace Geode
 		camera_->SetOrthoSize((float)elRoot_->GetHeight() * PIXEL_SIZE);
 	}
 
-	void SceneView::HandleSceneUpdate(StringHash, VariantMap& eventData)
+	void SceneView::HandleEditorUpdate(StringHash, VariantMap& eventData)
 	{
-		float ts = eventData[SceneUpdate::P_TIMESTEP].GetFloat();
+		GEODE_TRACE("SceneView::HandleEditorUpdate", "sceneview");
 
+		float ts = eventData[EditorUpdate::P_TIMESTEP].GetFloat();
+
+		// Sent before the tools update, so they see this frame's latest position.
+		FlushDragMove();
 		UpdateCameraMoves(ts);
+		editorScene_->GetWorldPartition()->SetFocus(cameraNode_->GetWorldPosition2D());
 		UpdateNodeSelection(ts);
 		UpdateMouseMove(ts);
 	}
@@ -240,10 +351,22 @@ namespace Geode
 
 	void SceneView::HandleScenePostRender(StringHash, VariantMap&)
 	{
+		GEODE_TRACE("SceneView::HandleScenePostRender", "overlay");
+
 		if (debugGeometryEnabled_ && editorScene_->HasComponent("DebugRenderer") && editorScene_->HasComponent("PhysicsWorld2D"))
 		{
 			editorScene_->GetComponent<PhysicsWorld2D>()->DrawDebugGeometry(editorScene_->GetComponent<DebugRenderer>(), false);
 		}
+
+		if (marqueeSelecting_ && editorScene_->HasComponent("DebugRenderer"))
+		{
+			DrawMarquee(editorScene_->GetComponent<DebugRenderer>());
+		}
+
+		if (performanceHud_->IsEnabled())
+		{
+			performanceHud_->SetNumOverlayGeometries(grid_->GetNumGeometries() + gizmo_->GetNumGeometries());
+		}
 	}
 
 	void SceneView::HandleMouseButtonDown(StringHash, VariantMap& eventData)
@@ -279,6 +402,7 @@ namespace Geode
 		if (dragging_ && button == MOUSEB_RIGHT)
 		{
 			dragging_ = false;
+			dragMovePending_ = false;
 			auto sendEventData = eventData;
 			sendEventData[SceneViewDragCancel::P_X] = mouseWorldPosition.x_;
 			sendEventData[SceneViewDragCancel::P_Y] = mouseWorldPosition.y_;
@@ -288,6 +412,8 @@ namespace Geode
 
 	void SceneView::HandleMouseMove(StringHash, VariantMap& eventData)
 	{
+		GEODE_TRACE("SceneView::HandleMouseMove", "sceneview");
+
 		auto ui = GetSubsystem<UI>();
 
 		if (!IsMouseInsideViewport() || ui->GetFocusElement())
@@ -295,17 +421,28 @@ namespace Geode
 			return;
 		}
 
-		auto mouseWorldPosition = GetMouseWorldPosition();
-		auto dragMouseDelta = mouseWorldPosition - beginDragMouseWorldPosition_;
+		if (!dragging_)
+		{
+			return;
+		}
 
-		if (dragging_)
+		dragMoveButtons_ = eventData[MouseMove::P_BUTTONS].GetInt();
+		dragMoveQualifiers_ = eventData[MouseMove::P_QUALIFIERS].GetInt();
+
+		// The unprojection is only paid per mouse event when somebody listens to the raw stream.
+		if (context_->GetEventReceivers(this, E_SCENEVIEW_RAWDRAGMOVE) != nullptr)
 		{
-			auto sendEventData = eventData;
-			sendEventData[SceneViewDragMove::P_X] = mouseWorldPosition.x_;
-			sendEventData[SceneViewDragMove::P_Y] = mouseWorldPosition.y_;
-			sendEventData[SceneViewDragMove::P_DX] = dragMouseDelta.x_;
-			sendEventData[SceneViewDragMove::P_DY] = dragMouseDelta.y_;
-			SendEvent(E_SCENEVIEW_DRAGMOVE, sendEventData);
+			SendDragMove(E_SCENEVIEW_RAWDRAGMOVE);
+		}
+
+		// High rate mice send several moves per frame, only the latest position is sent on scene update.
+		if (inputCoalescingEnabled_)
+		{
+			dragMovePending_ = true;
+		}
+		else
+		{
+			SendDragMove(E_SCENEVIEW_DRAGMOVE);
 		}
 	}
 
@@ -331,6 +468,9 @@ namespace Geode
 
 		if (dragging_ && button == MOUSEB_LEFT)
 		{
+			// Tools commit the last drag move they received.
+			FlushDragMove();
+
 			dragging_ = false;
 			auto sendEventData = eventData;
 			sendEventData[SceneViewDragCancel::P_X] = mouseWorldPosition.x_;
@@ -339,6 +479,79 @@ namespace Geode
 		}
 	}
 
+	void SceneView::HandleSceneViewDragBegin(StringHash, VariantMap& eventData)
+	{
+		if (!nodeSelectionEnabled_ || editorScene_->GetSelectedComponent() != nullptr)
+		{
+			return;
+		}
+
+		auto mouseWorldPosition = Vector2(eventData[SceneViewDragBegin::P_X].GetFloat(), eventData[SceneViewDragBegin::P_Y].GetFloat());
+
+		// Drags starting on a node belong to the tools, only empty space starts a marquee.
+		if (IsMouseInsideSelection() || editorScene_->GetNodeAt(mouseWorldPosition) != nullptr)
+		{
+			return;
+		}
+
+		marqueeSelecting_ = true;
+		marqueeBegin_ = marqueeEnd_ = mouseWorldPosition;
+	}
+
+	void SceneView::HandleSceneViewDragMove(StringHash, VariantMap& eventData)
+	{
+		if (marqueeSelecting_)
+		{
+			marqueeEnd_ = Vector2(eventData[SceneViewDragMove::P_X].GetFloat(), eventData[SceneViewDragMove::P_Y].GetFloat());
+		}
+	}
+
+	void SceneView::HandleSceneViewDragEnd(StringHash, VariantMap&)
+	{
+		if (!marqueeSelecting_)
+		{
+			return;
+		}
+
+		marqueeSelecting_ = false;
+		auto rect = GetMarqueeRect();
+
+		if (rect.Size().x_ < MARQUEE_MIN_SIZE && rect.Size().y_ < MARQUEE_MIN_SIZE)
+		{
+			return;
+		}
+
+		auto input = GetSubsystem<Input>();
+		editorScene_->GetNodesInRect(marqueeNodes_, rect);
+
+		if (input->GetQualifierDown(QUAL_CTRL))
+		{
+			for (auto node : marqueeNodes_)
+			{
+				editorScene_->ToggleSelectedObject(node);
+			}
+		}
+		else
+		{
+			if (!input->GetQualifierDown(QUAL_SHIFT))
+			{
+				editorScene_->ClearSelection();
+			}
+
+			for (auto node : marqueeNodes_)
+			{
+				editorScene_->AddSelectedObject(node);
+			}
+		}
+
+		marqueeNodes_.Clear();
+	}
+
+	void SceneView::HandleSceneViewDragCancel(StringHash, VariantMap&)
+	{
+		marqueeSelecting_ = false;
+	}
+
 	///------------------------------------------------------------------------------------------------
 	///  UPDATE METHODS
 	///------------------------------------------------------------------------------------------------
@@ -376,7 +589,9 @@ namespace Geode
 
 	void SceneView::UpdateNodeSelection(float ts)
 	{
-		if (!GetMouseButtonDown(MOUSEB_LEFT))
+		GEODE_TRACE("SceneView::UpdateNodeSelection", "sceneview");
+
+		if (!GetMouseButtonPress(MOUSEB_LEFT))
 		{
 			return;
 		}
@@ -398,12 +613,28 @@ namespace Geode
 			return;
 		}
 
-		editorScene_->SetSelectedObject(node);
+		auto input = GetSubsystem<Input>();
+
+		if (input->GetQualifierDown(QUAL_CTRL))
+		{
+			editorScene_->ToggleSelectedObject(node);
+		}
+		else if (input->GetQualifierDown(QUAL_SHIFT))
+		{
+			editorScene_->AddSelectedObject(node);
+		}
+		else if (!editorScene_->IsSelected(node))
+		{
+			// Pressing on an already selected node keeps the set, so the whole selection can be dragged.
+			editorScene_->SetSelectedObject(node);
+		}
 	}
 
 	void SceneView::UpdateMouseMove(float ts)
 	{
-		mouseWorldMove_ = GetMouseWorldPosition() - lastMouseWorldPosition_;
-		lastMouseWorldPosition_ = GetMouseWorldPosition();
+		auto mouseWorldPosition = GetMouseWorldPosition();
+
+		mouseWorldMove_ = mouseWorldPosition - lastMouseWorldPosition_;
+		lastMouseWorldPosition_ = mouseWorldPosition;
 	}
-}
+}
\ No newline at end of file
@@ -12,12 +12,14 @@
 
 #include "Gizmo.h"
 #include "Grid.h"
+#include "PerformanceHud.h"
 #include "EditorScene.h"
 #include "../Gui/IView.h"
 
 #include <Urho3D/Scene/Node.h>
 #include <Urho3D/Graphics/Camera.h>
 #include <Urho3D/Graphics/Viewport.h>
+#include <Urho3D/Graphics/DebugRenderer.h>
 
 namespace Geode
 {
@@ -37,11 +39,16 @@ namespace Geode
 		void SetNodeSelectionEnabled(bool enabled);
 		void SetNodePositionGizmoEnabled(bool enabled);
 		void SetGridEnabled(bool enabled);
+		void SetPerformanceHudEnabled(bool enabled);
+		void SetInputCoalescingEnabled(bool enabled);
+		void SetCameraPosition(const Urho3D::Vector2& position);
 		Geode::EditorScene::Ptr GetEditorScene();
 		bool GetDebugGeometryEnabled();
 		bool GetNodeSelectionEnabled();
 		bool GetNodePositionGizmoEnabled();
 		bool GetGridEnabled();
+		bool GetPerformanceHudEnabled();
+		bool GetInputCoalescingEnabled();
 		Urho3D::Vector2 GetMouseMove();
 		bool IsDragging();
 
@@ -50,23 +57,34 @@ namespace Geode
 		bool GetMouseButtonDown(Urho3D::MouseButtonFlags button);
 		bool GetMouseButtonPress(Urho3D::MouseButtonFlags button);
 		bool IsMouseInsideNode(Urho3D::Node* node);
+		bool IsMouseInsideSelection();
 		bool IsMouseInsideViewport();
 
 	private:
 		/// Event handlers.
 		void HandleResized(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
-		void HandleSceneUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleScenePostRender(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleMouseButtonDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleMouseMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 		void HandleMouseButtonUp(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
 
 		/// Update methods.
 		void UpdateCameraMoves(float ts);
 		void UpdateNodeSelection(float ts);
 		void UpdateMouseMove(float ts);
 
+		/// Other methods.
+		void SendDragMove(Urho3D::StringHash eventType);
+		void FlushDragMove();
+		Urho3D::Rect GetMarqueeRect() const;
+		void DrawMarquee(Urho3D::DebugRenderer* debugRenderer);
+
 	private:
 		Geode::EditorScene::Ptr editorScene_;
 		bool debugGeometryEnabled_;
@@ -75,10 +93,19 @@ namespace Geode
 		Urho3D::Vector2 mouseWorldMove_;
 		bool dragging_;
 		Urho3D::Vector2 beginDragMouseWorldPosition_;
+		bool inputCoalescingEnabled_;
+		bool dragMovePending_;
+		int dragMoveButtons_;
+		int dragMoveQualifiers_;
+		bool marqueeSelecting_;
+		Urho3D::Vector2 marqueeBegin_;
+		Urho3D::Vector2 marqueeEnd_;
+		Urho3D::PODVector<Urho3D::Node*> marqueeNodes_;
 		Urho3D::SharedPtr<Urho3D::Viewport> viewport_;
 		Urho3D::SharedPtr<Urho3D::Node> cameraNode_;
 		Urho3D::SharedPtr<Urho3D::Camera> camera_;
 		Urho3D::SharedPtr<Geode::Gizmo> gizmo_;
 		Urho3D::SharedPtr<Geode::Grid> grid_;
+		Urho3D::SharedPtr<Geode::PerformanceHud> performanceHud_;
 	};
 }
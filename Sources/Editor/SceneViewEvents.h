@@ -40,6 +40,17 @@ URHO3D_EVENT(E_SCENEVIEW_DRAGMOVE, SceneViewDragMove)
 	URHO3D_PARAM(P_QUALIFIERS, Qualifiers);        // int
 }
 
+/// Sent for every mouse move while dragging, only to tools asking for more than one drag move per frame.
+URHO3D_EVENT(E_SCENEVIEW_RAWDRAGMOVE, SceneViewRawDragMove)
+{
+	URHO3D_PARAM(P_X, X);                          // float
+	URHO3D_PARAM(P_Y, Y);                          // float
+	URHO3D_PARAM(P_DX, DX);                        // float
+	URHO3D_PARAM(P_DY, DY);                        // float
+	URHO3D_PARAM(P_BUTTONS, Buttons);              // int
+	URHO3D_PARAM(P_QUALIFIERS, Qualifiers);        // int
+}
+
 URHO3D_EVENT(E_SCENEVIEW_DRAGEND, SceneViewDragEnd)
 {
 	URHO3D_PARAM(P_X, X);                          // float
@@ -0,0 +1,144 @@
+#include "SimplificationPreview.h"
+#include "PolylineSimplifier.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/UI/UI.h>
+
+using namespace Urho3D;
+
+/// Five pixels of a sprite drawn at the default pixel size.
+static const float DEFAULT_MAX_DEVIATION = 0.05f;
+static const float MIN_MAX_DEVIATION = 0.001f;
+static const int PREVIEW_Z_INDEX = -4;
+static const Color PREVIEW_EDGE_COLOR = Color(1, 0, 1);
+static const int REPORT_MARGIN = 8;
+static const int REPORT_PRIORITY = 100;
+
+namespace Geode
+{
+	SimplificationPreview::SimplificationPreview(Context* context, SceneView::Ptr sceneView) : Object(context)
+	{
+		sceneView_ = sceneView;
+		editorScene_ = sceneView->GetEditorScene();
+		enabled_ = false;
+		dirty_ = true;
+		maxDeviation_ = DEFAULT_MAX_DEVIATION;
+		version_ = M_MAX_UNSIGNED;
+
+		previewNode_ = MakeShared<Node>(context_);
+		previewGeometry_ = previewNode_->CreateComponent<CustomGeometry>();
+		previewGeometry_->SetEnabled(false);
+
+		// Under the ui root like the performance hud, so it doesn't take part in the scene view layout.
+		reportText_ = GetSubsystem<UI>()->GetRoot()->CreateChild<Text>("SimplificationReport");
+		reportText_->SetStyleAuto();
+		reportText_->SetPriority(REPORT_PRIORITY);
+		reportText_->SetVisible(false);
+	}
+
+	SimplificationPreview::~SimplificationPreview()
+	{
+		reportText_->Remove();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void SimplificationPreview::SetEnabled(bool enabled)
+	{
+		enabled_ = enabled;
+		dirty_ = true;
+
+		if (!enabled_)
+		{
+			Hide();
+		}
+	}
+
+	void SimplificationPreview::SetMaxDeviation(float maxDeviation)
+	{
+		maxDeviation_ = Max(maxDeviation, MIN_MAX_DEVIATION);
+		dirty_ = true;
+	}
+
+	bool SimplificationPreview::IsEnabled() const
+	{
+		return enabled_;
+	}
+
+	float SimplificationPreview::GetMaxDeviation() const
+	{
+		return maxDeviation_;
+	}
+
+	const PODVector<Vector2>& SimplificationPreview::GetVertices() const
+	{
+		return vertices_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  UPDATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void SimplificationPreview::Update(Node* node, const PODVector<Vector2>& vertices, bool closed, unsigned version)
+	{
+		if (!enabled_)
+		{
+			Hide();
+			return;
+		}
+
+		if (!previewGeometry_->IsEnabled() && editorScene_->GetComponent<Octree>() != nullptr)
+		{
+			previewGeometry_->SetEnabled(true);
+			editorScene_->GetComponent<Octree>()->AddManualDrawable(previewGeometry_);
+			dirty_ = true;
+		}
+
+		auto sceneViewRoot = sceneView_->GetElementRoot();
+		previewNode_->SetTransform(node->GetTransform());
+		reportText_->SetPosition(sceneViewRoot->GetScreenPosition() + IntVector2(REPORT_MARGIN, sceneViewRoot->GetHeight() - reportText_->GetHeight() - REPORT_MARGIN));
+		reportText_->SetVisible(true);
+
+		// Simplified again only when the outline or the deviation change, not every frame.
+		if (!dirty_ && version == version_)
+		{
+			return;
+		}
+
+		dirty_ = false;
+		version_ = version;
+		PolylineSimplifier::Simplify(vertices, closed, maxDeviation_, vertices_);
+
+		auto numEdges = closed ? vertices_.Size() : Max(vertices_.Size(), 1U) - 1;
+		auto reduction = vertices.Size() > 0 ? 100.0f * (vertices.Size() - vertices_.Size()) / vertices.Size() : 0.0f;
+
+		previewGeometry_->Clear();
+		previewGeometry_->SetNumGeometries(1);
+		previewGeometry_->BeginGeometry(0, PrimitiveType::LINE_LIST);
+
+		for (unsigned i = 0; i < numEdges; i++)
+		{
+			previewGeometry_->DefineVertex(Vector3(vertices_[i], PREVIEW_Z_INDEX));
+			previewGeometry_->DefineColor(PREVIEW_EDGE_COLOR);
+			previewGeometry_->DefineVertex(Vector3(vertices_[(i + 1) % vertices_.Size()], PREVIEW_Z_INDEX));
+			previewGeometry_->DefineColor(PREVIEW_EDGE_COLOR);
+		}
+
+		previewGeometry_->SetMaterial(0, GetSubsystem<ResourceCache>()->GetResource<Material>("Materials/VColUnlit.xml"));
+		previewGeometry_->Commit();
+
+		reportText_->SetText(ToString("Simplify %u -> %u vertices (-%.0f%%), max deviation %.3f\nPage Up/Down: deviation, Enter: apply, S: close",
+			vertices.Size(), vertices_.Size(), reduction, maxDeviation_));
+	}
+
+	void SimplificationPreview::Hide()
+	{
+		previewGeometry_->SetEnabled(false);
+		reportText_->SetVisible(false);
+	}
+}
\ No newline at end of file
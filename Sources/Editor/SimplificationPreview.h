@@ -0,0 +1,57 @@
+/**
+ * @file    SimplificationPreview.h
+ * @ingroup Editor
+ * @brief   Overlay of a simplified collision outline and its vertex reduction, shared by the vertex tools.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "SceneView.h"
+#include "EditorScene.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Graphics/CustomGeometry.h>
+#include <Urho3D/UI/Text.h>
+
+namespace Geode
+{
+	class SimplificationPreview : public Urho3D::Object
+	{
+		URHO3D_OBJECT(SimplificationPreview, Urho3D::Object)
+
+	public:
+		using Ptr = Urho3D::SharedPtr<SimplificationPreview>;
+
+	public:
+		/// Constructors.
+		explicit SimplificationPreview(Urho3D::Context* context, Geode::SceneView::Ptr sceneView);
+		~SimplificationPreview();
+
+		/// Accessors & Mutators.
+		void SetEnabled(bool enabled);
+		void SetMaxDeviation(float maxDeviation);
+		bool IsEnabled() const;
+		float GetMaxDeviation() const;
+		const Urho3D::PODVector<Urho3D::Vector2>& GetVertices() const;
+
+		/// Update methods.
+		void Update(Urho3D::Node* node, const Urho3D::PODVector<Urho3D::Vector2>& vertices, bool closed, unsigned version);
+		void Hide();
+
+	private:
+		Geode::SceneView::Ptr sceneView_;
+		Geode::EditorScene::Ptr editorScene_;
+		Urho3D::SharedPtr<Urho3D::Node> previewNode_;
+		Urho3D::CustomGeometry* previewGeometry_;
+		Urho3D::SharedPtr<Urho3D::Text> reportText_;
+		Urho3D::PODVector<Urho3D::Vector2> vertices_;
+		bool enabled_;
+		bool dirty_;
+		float maxDeviation_;
+		unsigned version_;
+	};
+}
\ No newline at end of file
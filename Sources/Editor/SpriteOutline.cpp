@@ -0,0 +1,342 @@
+#include "SpriteOutline.h"
+#include "PolylineSimplifier.h"
+
+#include <Urho3D/Graphics/Texture2D.h>
+#include <Urho3D/Math/Rect.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Urho2D/Drawable2D.h>
+
+using namespace Urho3D;
+
+static const float DEFAULT_ALPHA_THRESHOLD = 0.5f;
+static const float DEFAULT_TOLERANCE = 1.0f;
+static const float MIN_OUTLINE_AREA = 2.0f;
+static const unsigned NO_EDGE = M_MAX_UNSIGNED;
+
+/// Marching squares segments per case, corners weighted top left 8, top right 4, bottom right 2, bottom left 1.
+/// Edges are 0 top, 1 right, 2 bottom, 3 left. Segments keep the solid side on their right, rows going down,
+/// saddles are split so diagonal pixels are two islands.
+static const int CASE_SEGMENTS[16][4] = {
+	{ -1, -1, -1, -1 },
+	{ 3, 2, -1, -1 },
+	{ 2, 1, -1, -1 },
+	{ 3, 1, -1, -1 },
+	{ 1, 0, -1, -1 },
+	{ 3, 2, 1, 0 },
+	{ 2, 0, -1, -1 },
+	{ 3, 0, -1, -1 },
+	{ 0, 3, -1, -1 },
+	{ 0, 2, -1, -1 },
+	{ 0, 3, 2, 1 },
+	{ 0, 1, -1, -1 },
+	{ 1, 3, -1, -1 },
+	{ 1, 2, -1, -1 },
+	{ 2, 3, -1, -1 },
+	{ -1, -1, -1, -1 }
+};
+
+/// Horizontal edges get even keys, vertical edges odd keys, both indexed by their top left sample.
+static inline unsigned GetEdgeKey(int x, int y, int edge, int gridWidth)
+{
+	switch (edge)
+	{
+	case 0: return (y * gridWidth + x) * 2;
+	case 1: return (y * gridWidth + x + 1) * 2 + 1;
+	case 2: return ((y + 1) * gridWidth + x) * 2;
+	default: return (y * gridWidth + x) * 2 + 1;
+	}
+}
+
+namespace Geode
+{
+	SpriteOutline::SpriteOutline(Context* context) : Object(context)
+	{
+		alphaThreshold_ = DEFAULT_ALPHA_THRESHOLD;
+		tolerance_ = DEFAULT_TOLERANCE;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void SpriteOutline::SetAlphaThreshold(float alphaThreshold)
+	{
+		alphaThreshold = Clamp(alphaThreshold, 0.0f, 1.0f);
+
+		if (alphaThreshold != alphaThreshold_)
+		{
+			alphaThreshold_ = alphaThreshold;
+			ClearCache();
+		}
+	}
+
+	void SpriteOutline::SetTolerance(float tolerance)
+	{
+		tolerance = Max(tolerance, 0.0f);
+
+		if (tolerance != tolerance_)
+		{
+			tolerance_ = tolerance;
+			ClearCache();
+		}
+	}
+
+	float SpriteOutline::GetAlphaThreshold() const
+	{
+		return alphaThreshold_;
+	}
+
+	float SpriteOutline::GetTolerance() const
+	{
+		return tolerance_;
+	}
+
+	unsigned SpriteOutline::GetNumCachedOutlines() const
+	{
+		return outlines_.Size();
+	}
+
+	bool SpriteOutline::HasOutlines(Sprite2D* sprite) const
+	{
+		return sprite != nullptr && sprite->GetTexture() != nullptr && outlines_.Contains(GetCacheKey(sprite));
+	}
+
+	void SpriteOutline::SetOutlines(Sprite2D* sprite, const IntVector2& size, const Vector<PODVector<Vector2>>& outlines)
+	{
+		if (sprite == nullptr || sprite->GetTexture() == nullptr)
+		{
+			return;
+		}
+
+		Entry entry;
+		entry.size = size;
+		entry.outlines = outlines;
+		outlines_[GetCacheKey(sprite)] = entry;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool SpriteOutline::GetOutlines(Sprite2D* sprite, Vector<PODVector<Vector2>>& dest)
+	{
+		dest.Clear();
+
+		if (sprite == nullptr || sprite->GetTexture() == nullptr)
+		{
+			return false;
+		}
+
+		auto key = GetCacheKey(sprite);
+		auto outlineIt = outlines_.Find(key);
+
+		if (outlineIt == outlines_.End())
+		{
+			auto image = GetSpriteImage(sprite);
+			auto rect = GetSpriteRect(sprite, image);
+			Entry entry;
+			entry.size = rect.Size();
+
+			// Failures are cached too, so a texture without readable data isn't fetched again for every sprite.
+			if (image != nullptr)
+			{
+				Trace(image, rect, alphaThreshold_, tolerance_, entry.outlines);
+			}
+
+			outlineIt = outlines_.Insert(MakePair(key, entry));
+		}
+
+		ToSpriteSpace(outlineIt->second_.outlines, outlineIt->second_.size, sprite->GetHotSpot(), dest);
+		return !dest.Empty();
+	}
+
+	void SpriteOutline::ClearCache()
+	{
+		outlines_.Clear();
+	}
+
+	SharedPtr<Image> SpriteOutline::GetSpriteImage(Sprite2D* sprite)
+	{
+		auto texture = sprite->GetTexture();
+		auto cache = sprite->GetSubsystem<ResourceCache>();
+
+		if (texture == nullptr)
+		{
+			return SharedPtr<Image>();
+		}
+
+		// The source image is preferred, reading the texture back isn't supported by every renderer nor headless.
+		if (cache != nullptr && !texture->GetName().Empty() && cache->Exists(texture->GetName()))
+		{
+			return SharedPtr<Image>(cache->GetResource<Image>(texture->GetName()));
+		}
+
+		return texture->GetImage();
+	}
+
+	IntRect SpriteOutline::GetSpriteRect(Sprite2D* sprite, const Image* image)
+	{
+		auto rect = sprite->GetRectangle();
+
+		// Headless textures are never uploaded and report no size, whole image sprites get it back from the image.
+		if ((rect.Width() <= 0 || rect.Height() <= 0) && image != nullptr)
+		{
+			rect = IntRect(0, 0, image->GetWidth(), image->GetHeight());
+		}
+
+		return rect;
+	}
+
+	void SpriteOutline::ToSpriteSpace(const Vector<PODVector<Vector2>>& outlines, const IntVector2& size, const Vector2& hotSpot, Vector<PODVector<Vector2>>& dest)
+	{
+		// Outlines are in pixels, rows going down. Sprite space goes up from the hot spot, as drawn by StaticSprite2D.
+		auto origin = Vector2(size.x_ * hotSpot.x_, size.y_ * hotSpot.y_);
+		dest.Clear();
+
+		for (auto& outline : outlines)
+		{
+			PODVector<Vector2> points;
+
+			for (auto& point : outline)
+			{
+				points.Push(Vector2(point.x_ - origin.x_, size.y_ - point.y_ - origin.y_) * PIXEL_SIZE);
+			}
+
+			dest.Push(points);
+		}
+	}
+
+	bool SpriteOutline::Trace(const Image* image, const IntRect& rect, float alphaThreshold, float tolerance, Vector<PODVector<Vector2>>& dest)
+	{
+		dest.Clear();
+
+		if (image == nullptr || image->IsCompressed() || image->GetData() == nullptr)
+		{
+			return false;
+		}
+
+		auto left = Max(rect.left_, 0);
+		auto top = Max(rect.top_, 0);
+		auto width = Min(rect.right_, image->GetWidth()) - left;
+		auto height = Min(rect.bottom_, image->GetHeight()) - top;
+
+		if (width <= 0 || height <= 0)
+		{
+			return false;
+		}
+
+		// One empty sample around the rect, so every contour closes.
+		auto gridWidth = width + 2;
+		auto gridHeight = height + 2;
+		auto components = image->GetComponents();
+		auto data = image->GetData();
+		auto threshold = (unsigned char)Clamp((int)Ceil(alphaThreshold * 255.0f), 1, 255);
+		PODVector<unsigned char> mask(gridWidth * gridHeight);
+		memset(mask.Buffer(), 0, mask.Size());
+
+		for (int y = 0; y < height; y++)
+		{
+			auto dst = &mask[(y + 1) * gridWidth + 1];
+
+			// Images without alpha are solid over the whole rect.
+			if (components == 3)
+			{
+				memset(dst, 1, width);
+				continue;
+			}
+
+			// Alpha is the last component of L, LA and RGBA images. Branchless, so the compiler vectorizes it.
+			auto src = data + ((top + y) * image->GetWidth() + left) * components + components - 1;
+
+			for (int x = 0; x < width; x++)
+			{
+				dst[x] = (unsigned char)(src[x * components] >= threshold);
+			}
+		}
+
+		PODVector<unsigned> next(gridWidth * gridHeight * 2);
+		PODVector<unsigned> starts;
+
+		for (auto& edge : next)
+		{
+			edge = NO_EDGE;
+		}
+
+		for (int y = 0; y + 1 < gridHeight; y++)
+		{
+			auto row = &mask[y * gridWidth];
+			auto nextRow = row + gridWidth;
+
+			for (int x = 0; x + 1 < gridWidth; x++)
+			{
+				auto segments = CASE_SEGMENTS[(row[x] << 3) | (row[x + 1] << 2) | (nextRow[x + 1] << 1) | nextRow[x]];
+
+				for (int i = 0; i < 4 && segments[i] != -1; i += 2)
+				{
+					auto from = GetEdgeKey(x, y, segments[i], gridWidth);
+					next[from] = GetEdgeKey(x, y, segments[i + 1], gridWidth);
+					starts.Push(from);
+				}
+			}
+		}
+
+		PODVector<Vector2> contour;
+		PODVector<Vector2> simplified;
+
+		for (auto start : starts)
+		{
+			if (next[start] == NO_EDGE)
+			{
+				continue;
+			}
+
+			auto edge = start;
+			auto area = 0.0f;
+			contour.Clear();
+
+			do
+			{
+				auto index = edge / 2;
+				auto x = (float)(index % gridWidth);
+				auto y = (float)(index / gridWidth);
+
+				// Edge midpoints, samples sit at pixel centers shifted by the padding.
+				contour.Push(edge % 2 == 0 ? Vector2(x, y - 0.5f) : Vector2(x - 0.5f, y));
+
+				auto nextEdge = next[edge];
+				next[edge] = NO_EDGE;
+				edge = nextEdge;
+			}
+			while (edge != start && edge != NO_EDGE);
+
+			for (unsigned i = 0; i < contour.Size(); i++)
+			{
+				auto& a = contour[i];
+				auto& b = contour[(i + 1) % contour.Size()];
+				area += a.x_ * b.y_ - b.x_ * a.y_;
+			}
+
+			// Outer contours turn clockwise on screen. Holes turn the other way and are filled, Box2D
+			// polygons can't have any.
+			if (area * 0.5f < MIN_OUTLINE_AREA)
+			{
+				continue;
+			}
+
+			PolylineSimplifier::Simplify(contour, true, tolerance, simplified);
+
+			if (simplified.Size() >= 3)
+			{
+				dest.Push(simplified);
+			}
+		}
+
+		return !dest.Empty();
+	}
+
+	StringHash SpriteOutline::GetCacheKey(Sprite2D* sprite)
+	{
+		// Sprites of a sheet share their texture, the rect tells them apart.
+		return StringHash(sprite->GetTexture()->GetName() + " " + sprite->GetRectangle().ToString());
+	}
+}
\ No newline at end of file
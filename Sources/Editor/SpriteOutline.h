@@ -0,0 +1,63 @@
+/**
+ * @file    SpriteOutline.h
+ * @ingroup Editor
+ * @brief   Collision outlines traced from the alpha of sprite textures, cached per texture rect.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Math/Vector2.h>
+#include <Urho3D/Resource/Image.h>
+#include <Urho3D/Urho2D/Sprite2D.h>
+
+namespace Geode
+{
+	class SpriteOutline : public Urho3D::Object
+	{
+		URHO3D_OBJECT(SpriteOutline, Urho3D::Object)
+
+		struct Entry {
+			Urho3D::IntVector2 size;
+			Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>> outlines;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<SpriteOutline>;
+
+	public:
+		/// Constructors.
+		explicit SpriteOutline(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetAlphaThreshold(float alphaThreshold);
+		void SetTolerance(float tolerance);
+		float GetAlphaThreshold() const;
+		float GetTolerance() const;
+		unsigned GetNumCachedOutlines() const;
+		bool HasOutlines(Urho3D::Sprite2D* sprite) const;
+		void SetOutlines(Urho3D::Sprite2D* sprite, const Urho3D::IntVector2& size, const Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& outlines);
+
+		/// Other methods.
+		bool GetOutlines(Urho3D::Sprite2D* sprite, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& dest);
+		void ClearCache();
+		static Urho3D::SharedPtr<Urho3D::Image> GetSpriteImage(Urho3D::Sprite2D* sprite);
+		static Urho3D::IntRect GetSpriteRect(Urho3D::Sprite2D* sprite, const Urho3D::Image* image);
+		static void ToSpriteSpace(const Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& outlines, const Urho3D::IntVector2& size, const Urho3D::Vector2& hotSpot, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& dest);
+		static bool Trace(const Urho3D::Image* image, const Urho3D::IntRect& rect, float alphaThreshold, float tolerance, Urho3D::Vector<Urho3D::PODVector<Urho3D::Vector2>>& dest);
+
+	private:
+		/// Other methods.
+		static Urho3D::StringHash GetCacheKey(Urho3D::Sprite2D* sprite);
+
+	private:
+		float alphaThreshold_;
+		float tolerance_;
+		Urho3D::HashMap<Urho3D::StringHash, Entry> outlines_;
+	};
+}
\ No newline at end of file
@@ -1,12 +1,31 @@
 #include "ToolsView.h"
+#include "EditorProfiler.h"
+#include "SceneViewEvents.h"
+#include "EditorSceneEvents.h"
+#include "../Gui/EventProfiler.h"
+
+#include <Urho3D/Scene/SceneEvents.h>
+#include <Urho3D/Input/InputEvents.h>
 
 using namespace Urho3D;
 
 namespace Geode
 {
-	ToolsView::ToolsView(Context* context, UIElement* parent) : IView(context, "UI/ToolsView.xml", parent)
+	ToolsView::ToolsView(Context* context, UIElement* parent, SceneView::Ptr sceneView) : IView(context, "UI/ToolsView.xml", parent)
 	{
 		toolBar_ = elRoot_->GetChildDynamicCast<ToolBar>("ToolBar", true);
+		sceneView_ = sceneView;
+		editorScene_ = sceneView->GetEditorScene();
+		activeToolsDirty_ = true;
+
+		// Subscribed once for all tools, events only reach the active ones.
+		SubscribeToEvent(editorScene_, E_SELECTEDOBJECTCHANGED, GEODE_HANDLER(ToolsView, HandleSelectedObjectChanged));
+		SubscribeToEvent(editorScene_, E_EDITORUPDATE, GEODE_HANDLER(ToolsView, HandleEditorUpdate));
+		SubscribeToEvent(E_KEYDOWN, GEODE_HANDLER(ToolsView, HandleKeyDown));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGBEGIN, GEODE_HANDLER(ToolsView, HandleSceneViewDragBegin));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGMOVE, GEODE_HANDLER(ToolsView, HandleSceneViewDragMove));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGEND, GEODE_HANDLER(ToolsView, HandleSceneViewDragEnd));
+		SubscribeToEvent(sceneView_, E_SCENEVIEW_DRAGCANCEL, GEODE_HANDLER(ToolsView, HandleSceneViewDragCancel));
 	}
 
 	///------------------------------------------------------------------------------------------------
@@ -17,8 +36,9 @@ namespace Geode
 	{
 		tool->PopulateToolBar(toolBar_);
 		tools_.Push(tool);
+		activeToolsDirty_ = true;
 
-		SubscribeToEvent(tool, E_TOOLSELECTED, URHO3D_HANDLER(ToolsView, HandleSelectedTool));
+		SubscribeToEvent(tool, E_TOOLSELECTED, GEODE_HANDLER(ToolsView, HandleSelectedTool));
 	}
 
 	void ToolsView::AddSeparator()
@@ -34,6 +54,104 @@ namespace Geode
 
 	void ToolsView::HandleSelectedTool(StringHash, VariantMap& eventData)
 	{
+		activeToolsDirty_ = true;
 		SendEvent(E_TOOLSELECTED, eventData);
 	}
-}
+
+	void ToolsView::HandleSelectedObjectChanged(StringHash, VariantMap&)
+	{
+		// Tools may handle this event after us, the active set is only rebuilt on the next dispatch.
+		activeToolsDirty_ = true;
+	}
+
+	void ToolsView::HandleEditorUpdate(StringHash eventType, VariantMap& eventData)
+	{
+		GEODE_PROFILE("Tools");
+
+		if (activeToolsDirty_)
+		{
+			UpdateActiveTools();
+		}
+
+		for (auto tool : activeTools_)
+		{
+			tool->HandleEditorUpdate(eventType, eventData);
+		}
+	}
+
+	void ToolsView::HandleKeyDown(StringHash eventType, VariantMap& eventData)
+	{
+		if (activeToolsDirty_)
+		{
+			UpdateActiveTools();
+		}
+
+		for (auto tool : activeTools_)
+		{
+			tool->HandleKeyDown(eventType, eventData);
+		}
+	}
+
+	void ToolsView::HandleSceneViewDragBegin(StringHash eventType, VariantMap& eventData)
+	{
+		// The selection may have changed since the last update, on the same click for instance.
+		UpdateActiveTools();
+
+		for (auto tool : activeTools_)
+		{
+			tool->HandleSceneViewDragBegin(eventType, eventData);
+		}
+	}
+
+	void ToolsView::HandleSceneViewDragMove(StringHash eventType, VariantMap& eventData)
+	{
+		for (auto tool : activeTools_)
+		{
+			tool->HandleSceneViewDragMove(eventType, eventData);
+		}
+	}
+
+	void ToolsView::HandleSceneViewDragEnd(StringHash eventType, VariantMap& eventData)
+	{
+		for (auto tool : activeTools_)
+		{
+			tool->HandleSceneViewDragEnd(eventType, eventData);
+		}
+	}
+
+	void ToolsView::HandleSceneViewDragCancel(StringHash eventType, VariantMap& eventData)
+	{
+		for (auto tool : activeTools_)
+		{
+			tool->HandleSceneViewDragCancel(eventType, eventData);
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  UPDATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void ToolsView::UpdateActiveTools()
+	{
+		// Tools which stopped being active get a chance to drop their editing state and overlays.
+		for (auto tool : activeTools_)
+		{
+			if (!tool->IsActive())
+			{
+				tool->Deactivate();
+			}
+		}
+
+		activeTools_.Clear();
+
+		for (auto& tool : tools_)
+		{
+			if (tool->IsActive())
+			{
+				activeTools_.Push(tool);
+			}
+		}
+
+		activeToolsDirty_ = false;
+	}
+}
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include "ITool.h"
 #include "ToolsEvents.h"
 #include "SeparatorTool.h"
+#include "SceneView.h"
+#include "EditorScene.h"
 #include "../Gui/IView.h"
 #include "../Gui/Toolbar.h"
 
@@ -24,7 +26,7 @@ namespace Geode
 
 	public:
 		/// Constructors.
-		explicit ToolsView(Urho3D::Context* context, Urho3D::UIElement* parent);
+		explicit ToolsView(Urho3D::Context* context, Urho3D::UIElement* parent, Geode::SceneView::Ptr sceneView);
 
 		/// Other methods.
 		void AddTool(Geode::ITool::Ptr tool);
@@ -33,9 +35,23 @@ namespace Geode
 	private:
 		/// Event handlers.
 		void HandleSelectedTool(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSelectedObjectChanged(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleKeyDown(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragBegin(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragMove(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragEnd(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+		void HandleSceneViewDragCancel(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Update methods.
+		void UpdateActiveTools();
 
 	private:
 		Geode::ToolBar* toolBar_;
+		Geode::SceneView::Ptr sceneView_;
+		Geode::EditorScene::Ptr editorScene_;
 		Urho3D::Vector<Geode::ITool::Ptr> tools_;
+		Urho3D::PODVector<Geode::ITool*> activeTools_;
+		bool activeToolsDirty_;
 	};
-}
+}
\ No newline at end of file
@@ -0,0 +1,354 @@
+#include "VertexGrid.h"
+#include "GridCells.h"
+
+#include <Urho3D/Container/Sort.h>
+
+using namespace Urho3D;
+
+static const float DEFAULT_CELL_SIZE = 1.0f;
+static const float MIN_CELL_SIZE = 0.01f;
+static const float CELL_SIZE_EDGE_RATIO = 2.0f;
+static const int MAX_CELLS_PER_EDGE = 64;
+static const unsigned INCREMENTAL_UPDATE_RATIO = 8;
+
+namespace Geode
+{
+	VertexGrid::VertexGrid(Context* context) : Object(context)
+	{
+		closed_ = false;
+		cellSize_ = DEFAULT_CELL_SIZE;
+		version_ = 0;
+		visitStamp_ = 0;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void VertexGrid::SetVertices(const PODVector<Vector2>& vertices, bool closed)
+	{
+		// Called every frame with the component vertices, so the common case is a compare and nothing else.
+		if (closed == closed_ && vertices.Size() == vertices_.Size())
+		{
+			PODVector<unsigned> changedIndices;
+			auto maxChangedIndices = vertices.Size() / INCREMENTAL_UPDATE_RATIO + 1;
+
+			for (unsigned i = 0; i < vertices.Size() && changedIndices.Size() <= maxChangedIndices; i++)
+			{
+				if (vertices[i] != vertices_[i])
+				{
+					changedIndices.Push(i);
+				}
+			}
+
+			if (changedIndices.Size() <= maxChangedIndices)
+			{
+				for (auto index : changedIndices)
+				{
+					SetVertex(index, vertices[index]);
+				}
+
+				return;
+			}
+		}
+
+		vertices_ = vertices;
+		closed_ = closed;
+		Rebuild();
+	}
+
+	void VertexGrid::SetVertex(unsigned index, const Vector2& vertex)
+	{
+		if (index >= vertices_.Size() || vertices_[index] == vertex)
+		{
+			return;
+		}
+
+		auto numEdges = GetNumEdges();
+		auto previousEdge = index > 0 ? index - 1 : (numEdges == vertices_.Size() ? numEdges - 1 : M_MAX_UNSIGNED);
+		auto nextEdge = index < numEdges ? index : M_MAX_UNSIGNED;
+
+		if (previousEdge != M_MAX_UNSIGNED)
+		{
+			RemoveEdge(previousEdge);
+		}
+
+		if (nextEdge != M_MAX_UNSIGNED && nextEdge != previousEdge)
+		{
+			RemoveEdge(nextEdge);
+		}
+
+		auto cellIt = vertexCells_.Find(GetCellCoords(vertices_[index]));
+
+		if (cellIt != vertexCells_.End())
+		{
+			cellIt->second_.Remove(index);
+
+			if (cellIt->second_.Empty())
+			{
+				vertexCells_.Erase(cellIt);
+			}
+		}
+
+		// The cell size is kept, a drag doesn't change the shape scale enough to matter.
+		vertices_[index] = vertex;
+		vertexCells_[GetCellCoords(vertex)].Push(index);
+
+		if (previousEdge != M_MAX_UNSIGNED)
+		{
+			InsertEdge(previousEdge);
+		}
+
+		if (nextEdge != M_MAX_UNSIGNED && nextEdge != previousEdge)
+		{
+			InsertEdge(nextEdge);
+		}
+
+		version_++;
+	}
+
+	const PODVector<Vector2>& VertexGrid::GetVertices() const
+	{
+		return vertices_;
+	}
+
+	unsigned VertexGrid::GetNumVertices() const
+	{
+		return vertices_.Size();
+	}
+
+	unsigned VertexGrid::GetNumEdges() const
+	{
+		if (vertices_.Size() < 2)
+		{
+			return 0;
+		}
+
+		// Edge i goes from vertex i to the next one, the closing edge only exists for real polygons.
+		return closed_ && vertices_.Size() >= 3 ? vertices_.Size() : vertices_.Size() - 1;
+	}
+
+	float VertexGrid::GetCellSize() const
+	{
+		return cellSize_;
+	}
+
+	bool VertexGrid::IsClosed() const
+	{
+		return closed_;
+	}
+
+	unsigned VertexGrid::GetVersion() const
+	{
+		return version_;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	int VertexGrid::GetNearestVertex(const Vector2& position, float maxDistance) const
+	{
+		auto best = -1;
+		auto bestDistance = maxDistance * maxDistance;
+		auto rect = Rect(position - Vector2(maxDistance, maxDistance), position + Vector2(maxDistance, maxDistance));
+
+		GridCells::Visit(vertexCells_, GetCellCoords(rect.min_), GetCellCoords(rect.max_), [&](const PODVector<unsigned>& cell)
+		{
+			for (auto index : cell)
+			{
+				auto distance = (vertices_[index] - position).LengthSquared();
+
+				// Ties go to the lowest index, like a linear scan would.
+				if (distance < bestDistance || (distance == bestDistance && (best == -1 || (int)index < best)))
+				{
+					best = index;
+					bestDistance = distance;
+				}
+			}
+		});
+
+		return best;
+	}
+
+	int VertexGrid::GetNearestEdge(const Vector2& position, float maxDistance)
+	{
+		auto best = -1;
+		auto bestDistance = maxDistance * maxDistance;
+		auto rect = Rect(position - Vector2(maxDistance, maxDistance), position + Vector2(maxDistance, maxDistance));
+
+		auto testEdge = [&](unsigned edgeIndex)
+		{
+			auto& a = vertices_[edgeIndex];
+			auto& b = vertices_[(edgeIndex + 1) % vertices_.Size()];
+			auto ab = b - a;
+			auto lengthSquared = ab.LengthSquared();
+			auto t = lengthSquared > 0.0f ? Clamp((position - a).DotProduct(ab) / lengthSquared, 0.0f, 1.0f) : 0.0f;
+			auto distance = (a + ab * t - position).LengthSquared();
+
+			if (distance < bestDistance || (distance == bestDistance && (best == -1 || (int)edgeIndex < best)))
+			{
+				best = edgeIndex;
+				bestDistance = distance;
+			}
+		};
+
+		// Edges spanning several cells are tested once per query thanks to the stamps.
+		if (++visitStamp_ == 0)
+		{
+			for (auto& stamp : visitStamps_)
+			{
+				stamp = 0;
+			}
+
+			visitStamp_ = 1;
+		}
+
+		GridCells::Visit(edgeCells_, GetCellCoords(rect.min_), GetCellCoords(rect.max_), [&](const PODVector<unsigned>& cell)
+		{
+			for (auto edgeIndex : cell)
+			{
+				if (visitStamps_[edgeIndex] != visitStamp_)
+				{
+					visitStamps_[edgeIndex] = visitStamp_;
+					testEdge(edgeIndex);
+				}
+			}
+		});
+
+		for (auto edgeIndex : oversizedEdges_)
+		{
+			testEdge(edgeIndex);
+		}
+
+		return best;
+	}
+
+	void VertexGrid::GetVerticesInRadius(PODVector<unsigned>& dest, const Vector2& position, float radius) const
+	{
+		auto radiusSquared = radius * radius;
+		auto rect = Rect(position - Vector2(radius, radius), position + Vector2(radius, radius));
+
+		dest.Clear();
+
+		GridCells::Visit(vertexCells_, GetCellCoords(rect.min_), GetCellCoords(rect.max_), [&](const PODVector<unsigned>& cell)
+		{
+			for (auto index : cell)
+			{
+				if ((vertices_[index] - position).LengthSquared() <= radiusSquared)
+				{
+					dest.Push(index);
+				}
+			}
+		});
+
+		Sort(dest.Begin(), dest.End());
+	}
+
+	IntVector2 VertexGrid::GetCellCoords(const Vector2& position) const
+	{
+		return IntVector2(FloorToInt(position.x_ / cellSize_), FloorToInt(position.y_ / cellSize_));
+	}
+
+	bool VertexGrid::IsOversizedEdge(unsigned edgeIndex, IntVector2& minCoords, IntVector2& maxCoords) const
+	{
+		auto& a = vertices_[edgeIndex];
+		auto& b = vertices_[(edgeIndex + 1) % vertices_.Size()];
+
+		minCoords = GetCellCoords(Vector2(Min(a.x_, b.x_), Min(a.y_, b.y_)));
+		maxCoords = GetCellCoords(Vector2(Max(a.x_, b.x_), Max(a.y_, b.y_)));
+
+		// Very long edges would flood the grid, they are tested on every query instead.
+		return (long long)(maxCoords.x_ - minCoords.x_ + 1) * (maxCoords.y_ - minCoords.y_ + 1) > MAX_CELLS_PER_EDGE;
+	}
+
+	void VertexGrid::InsertEdge(unsigned edgeIndex)
+	{
+		IntVector2 minCoords;
+		IntVector2 maxCoords;
+
+		if (IsOversizedEdge(edgeIndex, minCoords, maxCoords))
+		{
+			oversizedEdges_.Push(edgeIndex);
+			return;
+		}
+
+		for (auto y = minCoords.y_; y <= maxCoords.y_; y++)
+		{
+			for (auto x = minCoords.x_; x <= maxCoords.x_; x++)
+			{
+				edgeCells_[IntVector2(x, y)].Push(edgeIndex);
+			}
+		}
+	}
+
+	void VertexGrid::RemoveEdge(unsigned edgeIndex)
+	{
+		IntVector2 minCoords;
+		IntVector2 maxCoords;
+
+		if (IsOversizedEdge(edgeIndex, minCoords, maxCoords))
+		{
+			oversizedEdges_.Remove(edgeIndex);
+			return;
+		}
+
+		for (auto y = minCoords.y_; y <= maxCoords.y_; y++)
+		{
+			for (auto x = minCoords.x_; x <= maxCoords.x_; x++)
+			{
+				auto cellIt = edgeCells_.Find(IntVector2(x, y));
+
+				if (cellIt == edgeCells_.End())
+				{
+					continue;
+				}
+
+				cellIt->second_.Remove(edgeIndex);
+
+				if (cellIt->second_.Empty())
+				{
+					edgeCells_.Erase(cellIt);
+				}
+			}
+		}
+	}
+
+	void VertexGrid::Rebuild()
+	{
+		auto numEdges = GetNumEdges();
+		auto totalLength = 0.0f;
+
+		vertexCells_.Clear();
+		edgeCells_.Clear();
+		oversizedEdges_.Clear();
+
+		for (unsigned i = 0; i < numEdges; i++)
+		{
+			totalLength += (vertices_[(i + 1) % vertices_.Size()] - vertices_[i]).Length();
+		}
+
+		// Cells a bit larger than the mean edge keep both vertex and edge buckets short on outlines of any scale.
+		cellSize_ = numEdges > 0 ? Max(totalLength / numEdges * CELL_SIZE_EDGE_RATIO, MIN_CELL_SIZE) : DEFAULT_CELL_SIZE;
+
+		for (unsigned i = 0; i < vertices_.Size(); i++)
+		{
+			vertexCells_[GetCellCoords(vertices_[i])].Push(i);
+		}
+
+		for (unsigned i = 0; i < numEdges; i++)
+		{
+			InsertEdge(i);
+		}
+
+		visitStamps_.Resize(numEdges);
+
+		for (auto& stamp : visitStamps_)
+		{
+			stamp = 0;
+		}
+
+		visitStamp_ = 0;
+		version_++;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+/**
+ * @file    VertexGrid.h
+ * @ingroup Editor
+ * @brief   Uniform grid over the vertices and edges of an edited shape, used for vertex picking and insertion.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Math/Rect.h>
+#include <Urho3D/Math/Vector2.h>
+
+namespace Geode
+{
+	class VertexGrid : public Urho3D::Object
+	{
+		URHO3D_OBJECT(VertexGrid, Urho3D::Object)
+
+		using Cells = Urho3D::HashMap<Urho3D::IntVector2, Urho3D::PODVector<unsigned>>;
+
+	public:
+		using Ptr = Urho3D::SharedPtr<VertexGrid>;
+
+	public:
+		/// Constructors.
+		explicit VertexGrid(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetVertices(const Urho3D::PODVector<Urho3D::Vector2>& vertices, bool closed);
+		void SetVertex(unsigned index, const Urho3D::Vector2& vertex);
+		const Urho3D::PODVector<Urho3D::Vector2>& GetVertices() const;
+		unsigned GetNumVertices() const;
+		unsigned GetNumEdges() const;
+		float GetCellSize() const;
+		bool IsClosed() const;
+		unsigned GetVersion() const;
+
+		/// Other methods.
+		int GetNearestVertex(const Urho3D::Vector2& position, float maxDistance) const;
+		int GetNearestEdge(const Urho3D::Vector2& position, float maxDistance);
+		void GetVerticesInRadius(Urho3D::PODVector<unsigned>& dest, const Urho3D::Vector2& position, float radius) const;
+
+	private:
+		/// Other methods.
+		Urho3D::IntVector2 GetCellCoords(const Urho3D::Vector2& position) const;
+		bool IsOversizedEdge(unsigned edgeIndex, Urho3D::IntVector2& minCoords, Urho3D::IntVector2& maxCoords) const;
+		void InsertEdge(unsigned edgeIndex);
+		void RemoveEdge(unsigned edgeIndex);
+		void Rebuild();
+
+	private:
+		Urho3D::PODVector<Urho3D::Vector2> vertices_;
+		bool closed_;
+		float cellSize_;
+		unsigned version_;
+		Cells vertexCells_;
+		Cells edgeCells_;
+		Urho3D::PODVector<unsigned> oversizedEdges_;
+		Urho3D::PODVector<unsigned> visitStamps_;
+		unsigned visitStamp_;
+	};
+}
\ No newline at end of file
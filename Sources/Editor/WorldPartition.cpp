@@ -0,0 +1,771 @@
+#include "WorldPartition.h"
+#include "EditorScene.h"
+#include "EditorSceneEvents.h"
+#include "IdleMonitor.h"
+#include "../Gui/EventProfiler.h"
+
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Container/Sort.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/VectorBuffer.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Scene/SceneEvents.h>
+
+using namespace Urho3D;
+
+static const float DEFAULT_CELL_SIZE = 16.f;
+static const float DEFAULT_LOAD_RADIUS = 48.f;
+static const unsigned DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
+static const float UNLOAD_RADIUS_FACTOR = 1.25f;
+static const String CELL_DIRECTORY_SUFFIX = "_cells/";
+static const String UNSAVED_CELL_DIRECTORY = "unsaved_cells";
+
+namespace Geode
+{
+	WorldPartition::WorldPartition(Context* context, EditorScene* editorScene) : Object(context)
+	{
+		editorScene_ = editorScene;
+		loader_ = MakeShared<SceneLoader>(context_);
+		enabled_ = false;
+		cellSize_ = DEFAULT_CELL_SIZE;
+		loadRadius_ = DEFAULT_LOAD_RADIUS;
+		memoryBudget_ = DEFAULT_MEMORY_BUDGET;
+
+		SubscribeToEvent(editorScene_, E_EDITORUPDATE, GEODE_HANDLER(WorldPartition, HandleEditorUpdate));
+	}
+
+	WorldPartition::~WorldPartition()
+	{
+		Close();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void WorldPartition::SetEnabled(bool enabled)
+	{
+		if (enabled == enabled_)
+		{
+			return;
+		}
+
+		if (enabled)
+		{
+			enabled_ = true;
+			Partition();
+			return;
+		}
+
+		// Bring every cell back so the scene is whole again once partitioning stops.
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			if (!it->second_.loaded && !it->second_.failed && it->second_.task.Null())
+			{
+				BeginLoadCell(it->first_, it->second_);
+			}
+		}
+
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			if (it->second_.task.NotNull())
+			{
+				WaitLoadCell(it->first_, it->second_);
+			}
+		}
+
+		Close();
+		SendCellsChanged(false);
+	}
+
+	void WorldPartition::SetCellSize(float cellSize)
+	{
+		// Cell size only applies to partitions created afterwards, existing cell files keep their layout.
+		cellSize_ = Max(cellSize, M_EPSILON);
+	}
+
+	void WorldPartition::SetLoadRadius(float loadRadius)
+	{
+		loadRadius_ = Max(loadRadius, 0.f);
+	}
+
+	void WorldPartition::SetMemoryBudget(unsigned memoryBudget)
+	{
+		memoryBudget_ = memoryBudget;
+	}
+
+	void WorldPartition::SetFocus(const Vector2& focus)
+	{
+		focus_ = focus;
+	}
+
+	bool WorldPartition::IsEnabled() const
+	{
+		return enabled_;
+	}
+
+	float WorldPartition::GetCellSize() const
+	{
+		return cellSize_;
+	}
+
+	float WorldPartition::GetLoadRadius() const
+	{
+		return loadRadius_;
+	}
+
+	unsigned WorldPartition::GetMemoryBudget() const
+	{
+		return memoryBudget_;
+	}
+
+	unsigned WorldPartition::GetNumCells() const
+	{
+		return cells_.Size();
+	}
+
+	unsigned WorldPartition::GetNumLoadedCells() const
+	{
+		unsigned numLoadedCells = 0;
+
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			if (it->second_.loaded)
+			{
+				numLoadedCells++;
+			}
+		}
+
+		return numLoadedCells;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void WorldPartition::Open(const String& filename, const XMLElement& root)
+	{
+		Close();
+
+		auto partition = root.GetChild("partition");
+		if (partition.IsNull())
+		{
+			return;
+		}
+
+		cellSize_ = Max(partition.GetFloat("cellSize"), M_EPSILON);
+		loadRadius_ = partition.GetFloat("loadRadius");
+		memoryBudget_ = partition.GetUInt("memoryBudget");
+
+		for (auto cellElement = root.GetChild("cell"); cellElement.NotNull(); cellElement = cellElement.GetNext("cell"))
+		{
+			auto& cell = CreateCell(IntVector2(cellElement.GetInt("x"), cellElement.GetInt("y")), false);
+			cell.memoryUse = cellElement.GetUInt("size");
+		}
+
+		filename_ = filename;
+		enabled_ = true;
+	}
+
+	void WorldPartition::Close()
+	{
+		auto workQueue = GetSubsystem<WorkQueue>();
+
+		// Pending work items point to their task, they must be gone before the tasks are released.
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			auto& task = it->second_.task;
+
+			if (task.NotNull() && !workQueue->RemoveWorkItem(task->item))
+			{
+				while (!task->item->completed_)
+				{
+					Time::Sleep(0);
+				}
+			}
+		}
+
+		DeleteUnsavedCells();
+		cells_.Clear();
+		nodeCells_.Clear();
+		filename_ = String::EMPTY;
+		enabled_ = false;
+	}
+
+	bool WorldPartition::Save(const String& filename)
+	{
+		auto fileSystem = GetSubsystem<FileSystem>();
+		auto cellPath = GetCellPath(filename);
+		auto previousCellPath = filename_.Empty() ? String::EMPTY : GetCellPath(filename_);
+		auto fullSave = filename != filename_;
+
+		fileSystem->CreateDir(cellPath);
+
+		auto manifest = MakeShared<XMLFile>(context_);
+		auto root = manifest->CreateRoot("scene");
+		editorScene_->SaveManifestXML(root);
+
+		auto partition = root.CreateChild("partition");
+		partition.SetFloat("cellSize", cellSize_);
+		partition.SetFloat("loadRadius", loadRadius_);
+		partition.SetUInt("memoryBudget", memoryBudget_);
+
+		PODVector<IntVector2> emptyCells;
+		auto loaded = false;
+
+		// Sidecar files are promoted and deleted below, loads still reading them finish first.
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			if (it->second_.unsaved && it->second_.task.NotNull())
+			{
+				WaitLoadCell(it->first_, it->second_);
+				loaded = true;
+			}
+		}
+
+		if (loaded)
+		{
+			SendCellsChanged(false);
+		}
+
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			auto& coords = it->first_;
+			auto& cell = it->second_;
+
+			if (cell.dirty)
+			{
+				if (!SaveCell(coords, cell, cellPath + GetCellFileName(coords)))
+				{
+					return false;
+				}
+			}
+			else if (cell.unsaved)
+			{
+				// Streamed out since the last save, the edits wait in the sidecar file until now.
+				if (!fileSystem->Copy(GetUnsavedCellFileName(coords), cellPath + GetCellFileName(coords)))
+				{
+					return false;
+				}
+			}
+			else if (fullSave && !previousCellPath.Empty() && (!cell.loaded || cell.failed || cell.memoryUse > 0))
+			{
+				// Clean cells are identical to their file, unloaded ones are only reachable through it.
+				fileSystem->Copy(previousCellPath + GetCellFileName(coords), cellPath + GetCellFileName(coords));
+			}
+
+			if (cell.loaded && !cell.failed && cell.task.Null() && GetCellNodes(coords).Empty())
+			{
+				emptyCells.Push(coords);
+				continue;
+			}
+
+			auto cellElement = root.CreateChild("cell");
+			cellElement.SetInt("x", coords.x_);
+			cellElement.SetInt("y", coords.y_);
+			cellElement.SetUInt("size", cell.memoryUse);
+		}
+
+		if (!manifest->SaveFile(filename))
+		{
+			return false;
+		}
+
+		for (auto& coords : emptyCells)
+		{
+			cells_.Erase(coords);
+		}
+
+		DeleteUnsavedCells();
+		filename_ = filename;
+		return true;
+	}
+
+	void WorldPartition::MarkNodeDirty(Node* node)
+	{
+		if (!enabled_ || node == nullptr || node->IsTemporary())
+		{
+			return;
+		}
+
+		auto id = node->GetID();
+		auto coords = GetCellCoords(node->GetWorldPosition2D());
+		auto it = nodeCells_.Find(id);
+
+		if (it == nodeCells_.End() || it->second_ != coords)
+		{
+			// A node entering an unloaded cell pulls that cell in first, its file would be overwritten otherwise.
+			if (EnsureCellLoaded(coords))
+			{
+				it = nodeCells_.Find(id);
+				if (it != nodeCells_.End())
+				{
+					cells_[it->second_].dirty = true;
+					cells_[it->second_].edited = true;
+				}
+
+				nodeCells_[id] = coords;
+			}
+		}
+
+		it = nodeCells_.Find(id);
+		if (it != nodeCells_.End())
+		{
+			cells_[it->second_].dirty = true;
+			cells_[it->second_].edited = true;
+		}
+	}
+
+	void WorldPartition::RemoveNode(Node* node)
+	{
+		if (!enabled_ || node == nullptr)
+		{
+			return;
+		}
+
+		auto it = nodeCells_.Find(node->GetID());
+		if (it != nodeCells_.End())
+		{
+			cells_[it->second_].dirty = true;
+			cells_[it->second_].edited = true;
+			nodeCells_.Erase(it);
+		}
+	}
+
+	void WorldPartition::ReleaseEditedCells()
+	{
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			it->second_.edited = false;
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void WorldPartition::HandleEditorUpdate(StringHash, VariantMap&)
+	{
+		// Unloading would save simulated cells to disk, streaming waits for the preview to stop.
+		if (editorScene_->IsPlaying())
+		{
+			return;
+		}
+
+		UpdateStreaming();
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  WORK FUNCTIONS
+	///------------------------------------------------------------------------------------------------
+
+	void WorldPartition::LoadCellWork(const WorkItem* item, unsigned)
+	{
+		auto task = static_cast<LoadTask*>(item->aux_);
+		auto cache = task->file->GetSubsystem<ResourceCache>();
+
+		auto source = cache->GetFile(task->name, false);
+		task->success = source != nullptr && task->file->Load(*source) && task->loader->DecodeXMLFile(task->file, task->nodes);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  CELL METHODS
+	///------------------------------------------------------------------------------------------------
+
+	IntVector2 WorldPartition::GetCellCoords(const Vector2& position) const
+	{
+		return IntVector2(FloorToInt(position.x_ / cellSize_), FloorToInt(position.y_ / cellSize_));
+	}
+
+	float WorldPartition::GetCellDistance(const IntVector2& coords) const
+	{
+		auto min = Vector2(coords.x_ * cellSize_, coords.y_ * cellSize_);
+		auto max = min + Vector2(cellSize_, cellSize_);
+		auto dx = Max(Max(min.x_ - focus_.x_, focus_.x_ - max.x_), 0.f);
+		auto dy = Max(Max(min.y_ - focus_.y_, focus_.y_ - max.y_), 0.f);
+
+		return Sqrt(dx * dx + dy * dy);
+	}
+
+	String WorldPartition::GetCellFileName(const IntVector2& coords) const
+	{
+		return "Cell_" + String(coords.x_) + "_" + String(coords.y_) + ".xml";
+	}
+
+	String WorldPartition::GetCellPath(const String& filename) const
+	{
+		return GetPath(filename) + GetFileName(filename) + CELL_DIRECTORY_SUFFIX;
+	}
+
+	String WorldPartition::GetUnsavedCellFileName(const IntVector2& coords) const
+	{
+		// Kept out of the scene directory, so the saved scene only ever changes on save.
+		auto path = GetSubsystem<FileSystem>()->GetAppPreferencesDir("urho3d", UNSAVED_CELL_DIRECTORY);
+		return path + StringHash(filename_).ToString() + "_" + GetCellFileName(coords);
+	}
+
+	WorldPartition::Cell& WorldPartition::CreateCell(const IntVector2& coords, bool loaded)
+	{
+		Cell cell;
+		cell.loaded = loaded;
+		cell.dirty = false;
+		cell.failed = false;
+		cell.unsaved = false;
+		cell.edited = false;
+		cell.memoryUse = 0;
+
+		cells_[coords] = cell;
+		return cells_[coords];
+	}
+
+	PODVector<Node*> WorldPartition::GetCellNodes(const IntVector2& coords) const
+	{
+		PODVector<Node*> nodes;
+
+		for (auto& child : editorScene_->GetChildren())
+		{
+			auto it = nodeCells_.Find(child->GetID());
+			if (it != nodeCells_.End() && it->second_ == coords)
+			{
+				nodes.Push(child);
+			}
+		}
+
+		return nodes;
+	}
+
+	void WorldPartition::Partition()
+	{
+		cells_.Clear();
+		nodeCells_.Clear();
+		filename_ = String::EMPTY;
+
+		for (auto& child : editorScene_->GetChildren())
+		{
+			if (child->IsTemporary())
+			{
+				continue;
+			}
+
+			auto coords = GetCellCoords(child->GetWorldPosition2D());
+			if (!cells_.Contains(coords))
+			{
+				CreateCell(coords, true);
+			}
+
+			cells_[coords].dirty = true;
+			nodeCells_[child->GetID()] = coords;
+		}
+	}
+
+	void WorldPartition::BeginLoadCell(const IntVector2& coords, Cell& cell)
+	{
+		auto task = MakeShared<LoadTask>();
+		task->loader = loader_;
+		task->name = cell.unsaved ? GetUnsavedCellFileName(coords) : GetCellPath(filename_) + GetCellFileName(coords);
+		task->file = MakeShared<XMLFile>(context_);
+		task->success = false;
+
+		// Not taken from the work queue pool: the item is polled until completion and must not be recycled meanwhile.
+		task->item = MakeShared<WorkItem>();
+		task->item->workFunction_ = LoadCellWork;
+		task->item->aux_ = task.Get();
+
+		cell.task = task;
+		GetSubsystem<WorkQueue>()->AddWorkItem(task->item);
+	}
+
+	void WorldPartition::EndLoadCell(const IntVector2& coords, Cell& cell)
+	{
+		auto task = cell.task;
+		cell.task.Reset();
+
+		if (!task->success)
+		{
+			// Unreadable cells are left untouched on disk and never retried.
+			cell.failed = true;
+			return;
+		}
+
+		editorScene_->SetBlockEvents(true);
+		auto nodes = loader_->InstantiateSubtrees(editorScene_, task->nodes, task->file);
+		editorScene_->SetBlockEvents(false);
+
+		for (auto node : nodes)
+		{
+			nodeCells_[node->GetID()] = coords;
+		}
+
+		// Cells brought back from the sidecar still differ from the saved scene.
+		if (cell.unsaved)
+		{
+			GetSubsystem<FileSystem>()->Delete(task->name);
+		}
+
+		cell.loaded = true;
+		cell.dirty = cell.unsaved;
+		cell.unsaved = false;
+		cell.memoryUse = task->file->GetMemoryUse();
+	}
+
+	void WorldPartition::WaitLoadCell(const IntVector2& coords, Cell& cell)
+	{
+		auto workQueue = GetSubsystem<WorkQueue>();
+
+		while (!cell.task->item->completed_)
+		{
+			// Not picked up by a worker yet: run it right here.
+			if (workQueue->RemoveWorkItem(cell.task->item))
+			{
+				LoadCellWork(cell.task->item, 0);
+				break;
+			}
+
+			Time::Sleep(0);
+		}
+
+		EndLoadCell(coords, cell);
+	}
+
+	bool WorldPartition::EnsureCellLoaded(const IntVector2& coords)
+	{
+		auto it = cells_.Find(coords);
+		if (it == cells_.End())
+		{
+			CreateCell(coords, true);
+			return true;
+		}
+
+		auto& cell = it->second_;
+
+		if (!cell.loaded && !cell.failed)
+		{
+			if (cell.task.Null())
+			{
+				BeginLoadCell(coords, cell);
+			}
+
+			WaitLoadCell(coords, cell);
+			SendCellsChanged(false);
+		}
+
+		return cell.loaded;
+	}
+
+	bool WorldPartition::UnloadCell(const IntVector2& coords, Cell& cell)
+	{
+		// Undoable commands keep raw pointers on edited nodes, their cells stay in until the history is cleared.
+		if (!cell.loaded || cell.task.NotNull() || cell.edited)
+		{
+			return false;
+		}
+
+		auto nodes = GetCellNodes(coords);
+
+		// Dirty cells can only leave memory once persisted, to a sidecar file rather than the saved scene.
+		if (cell.dirty)
+		{
+			if (filename_.Empty() || nodes.Empty() || !SaveCell(coords, cell, GetUnsavedCellFileName(coords)))
+			{
+				return false;
+			}
+
+			cell.unsaved = true;
+		}
+
+		// Scene events are blocked below, so drop the selection ourselves if it lives in this cell.
+		for (auto node : nodes)
+		{
+			editorScene_->DeselectSubtree(node);
+		}
+
+		editorScene_->SetBlockEvents(true);
+
+		for (auto node : nodes)
+		{
+			nodeCells_.Erase(node->GetID());
+			node->Remove();
+		}
+
+		editorScene_->SetBlockEvents(false);
+
+		cell.loaded = false;
+		return true;
+	}
+
+	bool WorldPartition::SaveCell(const IntVector2& coords, Cell& cell, const String& fileName)
+	{
+		auto fileSystem = GetSubsystem<FileSystem>();
+		auto nodes = GetCellNodes(coords);
+
+		if (nodes.Empty())
+		{
+			if (fileSystem->FileExists(fileName))
+			{
+				fileSystem->Delete(fileName);
+			}
+
+			cell.memoryUse = 0;
+			cell.dirty = false;
+			return true;
+		}
+
+		auto xmlFile = MakeShared<XMLFile>(context_);
+		auto root = xmlFile->CreateRoot("cell");
+
+		for (auto node : nodes)
+		{
+			auto nodeElement = root.CreateChild("node");
+			node->SaveXML(nodeElement);
+		}
+
+		VectorBuffer buffer;
+		xmlFile->Save(buffer);
+
+		File file(context_, fileName, FILE_WRITE);
+		if (!file.IsOpen() || file.Write(buffer.GetData(), buffer.GetSize()) != buffer.GetSize())
+		{
+			return false;
+		}
+
+		cell.memoryUse = buffer.GetSize();
+		cell.dirty = false;
+		return true;
+	}
+
+	void WorldPartition::DeleteUnsavedCells()
+	{
+		auto fileSystem = GetSubsystem<FileSystem>();
+
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			if (it->second_.unsaved)
+			{
+				fileSystem->Delete(GetUnsavedCellFileName(it->first_));
+				it->second_.unsaved = false;
+			}
+		}
+	}
+
+	void WorldPartition::SendCellsChanged(bool unloaded)
+	{
+		// Cells are swapped with scene events blocked, picking rects must be rebuilt.
+		editorScene_->GetSpatialIndex()->MarkDirty();
+
+		VariantMap sendEventData;
+		sendEventData[SceneCellsChanged::P_UNLOADED] = unloaded;
+		editorScene_->SendEvent(E_SCENECELLSCHANGED, sendEventData);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  UPDATE METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void WorldPartition::UpdateStreaming()
+	{
+		if (!enabled_)
+		{
+			return;
+		}
+
+		auto loaded = false;
+		auto unloaded = false;
+		auto streaming = false;
+		unsigned memoryUse = 0;
+
+		// Instantiate cells decoded in the background.
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			if (it->second_.task.NotNull() && it->second_.task->item->completed_)
+			{
+				EndLoadCell(it->first_, it->second_);
+				loaded = true;
+			}
+		}
+
+		// Unload cells which left the streaming radius, with some slack to avoid thrashing at the border.
+		PODVector<IntVector2> candidates;
+		PODVector<IntVector2> evictables;
+
+		for (auto it = cells_.Begin(); it != cells_.End(); ++it)
+		{
+			auto& cell = it->second_;
+			auto distance = GetCellDistance(it->first_);
+
+			if (cell.loaded && distance > loadRadius_ * UNLOAD_RADIUS_FACTOR && UnloadCell(it->first_, cell))
+			{
+				unloaded = true;
+			}
+
+			if (cell.loaded || cell.task.NotNull())
+			{
+				memoryUse += cell.memoryUse;
+			}
+
+			if (cell.loaded && cell.task.Null())
+			{
+				evictables.Push(it->first_);
+			}
+			else if (!cell.loaded && !cell.failed && cell.task.Null() && distance <= loadRadius_)
+			{
+				candidates.Push(it->first_);
+			}
+		}
+
+		// Request the nearest cells first, evicting the farthest ones while over the memory budget.
+		Sort(candidates.Begin(), candidates.End(), [this](const IntVector2& a, const IntVector2& b) {
+			return GetCellDistance(a) < GetCellDistance(b);
+		});
+
+		Sort(evictables.Begin(), evictables.End(), [this](const IntVector2& a, const IntVector2& b) {
+			return GetCellDistance(a) > GetCellDistance(b);
+		});
+
+		unsigned evictIndex = 0;
+
+		for (auto& coords : candidates)
+		{
+			auto& cell = cells_[coords];
+			auto distance = GetCellDistance(coords);
+
+			while (memoryUse + cell.memoryUse > memoryBudget_ && evictIndex < evictables.Size() && GetCellDistance(evictables[evictIndex]) > distance)
+			{
+				auto& evicted = cells_[evictables[evictIndex++]];
+				auto evictedMemoryUse = evicted.memoryUse;
+
+				if (UnloadCell(evictables[evictIndex - 1], evicted))
+				{
+					memoryUse -= evictedMemoryUse;
+					unloaded = true;
+				}
+			}
+
+			if (memoryUse + cell.memoryUse > memoryBudget_)
+			{
+				break;
+			}
+
+			BeginLoadCell(coords, cell);
+			memoryUse += cell.memoryUse;
+		}
+
+		for (auto it = cells_.Begin(); it != cells_.End() && !streaming; ++it)
+		{
+			streaming = it->second_.task.NotNull();
+		}
+
+		if (loaded || unloaded)
+		{
+			SendCellsChanged(unloaded);
+		}
+
+		// Background loads complete on later frames, which must not be throttled.
+		auto idleMonitor = GetSubsystem<IdleMonitor>();
+
+		if (streaming && idleMonitor != nullptr)
+		{
+			idleMonitor->KeepAwake();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+ * @file    WorldPartition.h
+ * @ingroup Editor
+ * @brief   Splits the scene into spatial cells streamed around the camera.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "SceneLoader.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Scene/Node.h>
+#include <Urho3D/Resource/XMLFile.h>
+#include <Urho3D/Resource/XMLElement.h>
+#include <Urho3D/Math/Vector2.h>
+
+namespace Geode
+{
+	class EditorScene;
+
+	class WorldPartition : public Urho3D::Object
+	{
+		URHO3D_OBJECT(WorldPartition, Urho3D::Object)
+
+		struct LoadTask : public Urho3D::RefCounted {
+			Geode::SceneLoader* loader;
+			Urho3D::String name;
+			Urho3D::SharedPtr<Urho3D::XMLFile> file;
+			Urho3D::Vector<Geode::SceneLoader::NodeData> nodes;
+			Urho3D::SharedPtr<Urho3D::WorkItem> item;
+			bool success;
+		};
+
+		struct Cell {
+			bool loaded;
+			bool dirty;
+			bool failed;
+			bool unsaved;
+			bool edited;
+			unsigned memoryUse;
+			Urho3D::SharedPtr<LoadTask> task;
+		};
+
+	public:
+		using Ptr = Urho3D::SharedPtr<WorldPartition>;
+
+	public:
+		/// Constructors.
+		explicit WorldPartition(Urho3D::Context* context, Geode::EditorScene* editorScene);
+		~WorldPartition();
+
+		/// Accessors & Mutators.
+		void SetEnabled(bool enabled);
+		void SetCellSize(float cellSize);
+		void SetLoadRadius(float loadRadius);
+		void SetMemoryBudget(unsigned memoryBudget);
+		void SetFocus(const Urho3D::Vector2& focus);
+		bool IsEnabled() const;
+		float GetCellSize() const;
+		float GetLoadRadius() const;
+		unsigned GetMemoryBudget() const;
+		unsigned GetNumCells() const;
+		unsigned GetNumLoadedCells() const;
+
+		/// Other methods.
+		void Open(const Urho3D::String& filename, const Urho3D::XMLElement& root);
+		void Close();
+		bool Save(const Urho3D::String& filename);
+		void MarkNodeDirty(Urho3D::Node* node);
+		void RemoveNode(Urho3D::Node* node);
+		void ReleaseEditedCells();
+
+	private:
+		/// Event handlers.
+		void HandleEditorUpdate(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Work functions.
+		static void LoadCellWork(const Urho3D::WorkItem* item, unsigned threadIndex);
+
+		/// Cell methods.
+		Urho3D::IntVector2 GetCellCoords(const Urho3D::Vector2& position) const;
+		float GetCellDistance(const Urho3D::IntVector2& coords) const;
+		Urho3D::String GetCellFileName(const Urho3D::IntVector2& coords) const;
+		Urho3D::String GetCellPath(const Urho3D::String& filename) const;
+		Urho3D::String GetUnsavedCellFileName(const Urho3D::IntVector2& coords) const;
+		Cell& CreateCell(const Urho3D::IntVector2& coords, bool loaded);
+		Urho3D::PODVector<Urho3D::Node*> GetCellNodes(const Urho3D::IntVector2& coords) const;
+		void Partition();
+		void BeginLoadCell(const Urho3D::IntVector2& coords, Cell& cell);
+		void EndLoadCell(const Urho3D::IntVector2& coords, Cell& cell);
+		void WaitLoadCell(const Urho3D::IntVector2& coords, Cell& cell);
+		bool EnsureCellLoaded(const Urho3D::IntVector2& coords);
+		bool UnloadCell(const Urho3D::IntVector2& coords, Cell& cell);
+		bool SaveCell(const Urho3D::IntVector2& coords, Cell& cell, const Urho3D::String& fileName);
+		void DeleteUnsavedCells();
+		void SendCellsChanged(bool unloaded);
+
+		/// Update methods.
+		void UpdateStreaming();
+
+	private:
+		Geode::EditorScene* editorScene_;
+		Urho3D::SharedPtr<Geode::SceneLoader> loader_;
+		bool enabled_;
+		float cellSize_;
+		float loadRadius_;
+		unsigned memoryBudget_;
+		Urho3D::String filename_;
+		Urho3D::Vector2 focus_;
+		Urho3D::HashMap<Urho3D::IntVector2, Cell> cells_;
+		Urho3D::HashMap<unsigned, Urho3D::IntVector2> nodeCells_;
+	};
+}
\ No newline at end of file
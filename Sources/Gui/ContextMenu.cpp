@@ -1,4 +1,5 @@
 #include "ContextMenu.h"
+#include "EventProfiler.h"
 
 #include <Urho3D/Core/Context.h>
 #include <Urho3D/UI/UI.h>
@@ -15,7 +16,7 @@ namespace Geode
 		flyMenu_->SetStyleAuto();
 		flyMenu_->SetVisible(false);
 
-		SubscribeToEvent(flyMenu_, E_FLYMENU_CLOSED, URHO3D_HANDLER(ContextMenu, HandleFlyMenuClosed));
+		SubscribeToEvent(flyMenu_, E_FLYMENU_CLOSED, GEODE_HANDLER(ContextMenu, HandleFlyMenuClosed));
 	}
 
 	ContextMenu::~ContextMenu()
@@ -1,5 +1,6 @@
 #include "Controls.h"
 #include "Helper.h"
+#include "EventProfiler.h"
 
 #include <Urho3D/Input/InputEvents.h>
 #include <Urho3D/UI/UIEvents.h>
@@ -52,9 +53,9 @@ namespace Geode
 		lineEdit_ = CreateChild<LineEdit>("FC_LineEdit");
 		lineEdit_->SetInternal(true);
 
-		SubscribeToEvent(E_MOUSEWHEEL, URHO3D_HANDLER(FloatControl, HandleMouseWheel));
-		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, URHO3D_HANDLER(FloatControl, HandleTextChanged));
-		SubscribeToEvent(lineEdit_, E_TEXTENTRY, URHO3D_HANDLER(FloatControl, HandleTextEntry));
+		SubscribeToEvent(E_MOUSEWHEEL, GEODE_HANDLER(FloatControl, HandleMouseWheel));
+		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, GEODE_HANDLER(FloatControl, HandleTextChanged));
+		SubscribeToEvent(lineEdit_, E_TEXTENTRY, GEODE_HANDLER(FloatControl, HandleTextEntry));
 	}
 
 	void FloatControl::RegisterObject(Context* context)
@@ -221,7 +222,7 @@ namespace Geode
 		angleControl_->SetMin(0);
 		angleControl_->SetMax(360);
 
-		SubscribeToEvent(angleControl_, E_CONTROLCHANGED, URHO3D_HANDLER(QuaternionControl, HandleAngleControlChanged));
+		SubscribeToEvent(angleControl_, E_CONTROLCHANGED, GEODE_HANDLER(QuaternionControl, HandleAngleControlChanged));
 	}
 
 	void QuaternionControl::RegisterObject(Context* context)
@@ -272,8 +273,8 @@ namespace Geode
 		yControl_ = CreateChild<FloatControl>("VC_YControl");
 		yControl_->SetInternal(true);
 
-		SubscribeToEvent(xControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector2Control, HandleXControlChanged));
-		SubscribeToEvent(yControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector2Control, HandleYControlChanged));
+		SubscribeToEvent(xControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector2Control, HandleXControlChanged));
+		SubscribeToEvent(yControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector2Control, HandleYControlChanged));
 	}
 
 	void Vector2Control::RegisterObject(Context* context)
@@ -341,9 +342,9 @@ namespace Geode
 		zControl_ = CreateChild<FloatControl>("VC_ZControl");
 		zControl_->SetInternal(true);
 
-		SubscribeToEvent(xControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector3Control, HandleXControlChanged));
-		SubscribeToEvent(yControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector3Control, HandleYControlChanged));
-		SubscribeToEvent(zControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector3Control, HandleZControlChanged));
+		SubscribeToEvent(xControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector3Control, HandleXControlChanged));
+		SubscribeToEvent(yControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector3Control, HandleYControlChanged));
+		SubscribeToEvent(zControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector3Control, HandleZControlChanged));
 	}
 
 	void Vector3Control::RegisterObject(Context* context)
@@ -426,10 +427,10 @@ namespace Geode
 		wControl_ = CreateChild<FloatControl>("VC_WControl");
 		wControl_->SetInternal(true);
 
-		SubscribeToEvent(xControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector4Control, HandleXControlChanged));
-		SubscribeToEvent(yControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector4Control, HandleYControlChanged));
-		SubscribeToEvent(zControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector4Control, HandleZControlChanged));
-		SubscribeToEvent(wControl_, E_CONTROLCHANGED, URHO3D_HANDLER(Vector4Control, HandleWControlChanged));
+		SubscribeToEvent(xControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector4Control, HandleXControlChanged));
+		SubscribeToEvent(yControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector4Control, HandleYControlChanged));
+		SubscribeToEvent(zControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector4Control, HandleZControlChanged));
+		SubscribeToEvent(wControl_, E_CONTROLCHANGED, GEODE_HANDLER(Vector4Control, HandleWControlChanged));
 	}
 
 	void Vector4Control::RegisterObject(Context* context)
@@ -524,10 +525,10 @@ namespace Geode
 		y2Control_ = CreateChild<FloatControl>("RC_Y2Control");
 		y2Control_->SetInternal(true);
 
-		SubscribeToEvent(x1Control_, E_CONTROLCHANGED, URHO3D_HANDLER(RectControl, HandleX1ControlChanged));
-		SubscribeToEvent(y1Control_, E_CONTROLCHANGED, URHO3D_HANDLER(RectControl, HandleY1ControlChanged));
-		SubscribeToEvent(x2Control_, E_CONTROLCHANGED, URHO3D_HANDLER(RectControl, HandleX2ControlChanged));
-		SubscribeToEvent(y2Control_, E_CONTROLCHANGED, URHO3D_HANDLER(RectControl, HandleY2ControlChanged));
+		SubscribeToEvent(x1Control_, E_CONTROLCHANGED, GEODE_HANDLER(RectControl, HandleX1ControlChanged));
+		SubscribeToEvent(y1Control_, E_CONTROLCHANGED, GEODE_HANDLER(RectControl, HandleY1ControlChanged));
+		SubscribeToEvent(x2Control_, E_CONTROLCHANGED, GEODE_HANDLER(RectControl, HandleX2ControlChanged));
+		SubscribeToEvent(y2Control_, E_CONTROLCHANGED, GEODE_HANDLER(RectControl, HandleY2ControlChanged));
 	}
 
 	void RectControl::RegisterObject(Context* context)
@@ -630,10 +631,10 @@ namespace Geode
 		aControl_->SetMin(0);
 		aControl_->SetMax(1);
 
-		SubscribeToEvent(rControl_, E_CONTROLCHANGED, URHO3D_HANDLER(ColorControl, HandleRControlChanged));
-		SubscribeToEvent(gControl_, E_CONTROLCHANGED, URHO3D_HANDLER(ColorControl, HandleGControlChanged));
-		SubscribeToEvent(bControl_, E_CONTROLCHANGED, URHO3D_HANDLER(ColorControl, HandleBControlChanged));
-		SubscribeToEvent(aControl_, E_CONTROLCHANGED, URHO3D_HANDLER(ColorControl, HandleAControlChanged));
+		SubscribeToEvent(rControl_, E_CONTROLCHANGED, GEODE_HANDLER(ColorControl, HandleRControlChanged));
+		SubscribeToEvent(gControl_, E_CONTROLCHANGED, GEODE_HANDLER(ColorControl, HandleGControlChanged));
+		SubscribeToEvent(bControl_, E_CONTROLCHANGED, GEODE_HANDLER(ColorControl, HandleBControlChanged));
+		SubscribeToEvent(aControl_, E_CONTROLCHANGED, GEODE_HANDLER(ColorControl, HandleAControlChanged));
 	}
 
 	void ColorControl::RegisterObject(Context* context)
@@ -722,9 +723,9 @@ namespace Geode
 		lineEdit_ = CreateChild<LineEdit>("IC_LineEdit");
 		lineEdit_->SetInternal(true);
 
-		SubscribeToEvent(E_MOUSEWHEEL, URHO3D_HANDLER(IntegerControl, HandleMouseWheel));
-		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, URHO3D_HANDLER(IntegerControl, HandleTextChanged));
-		SubscribeToEvent(lineEdit_, E_TEXTENTRY, URHO3D_HANDLER(IntegerControl, HandleTextEntry));
+		SubscribeToEvent(E_MOUSEWHEEL, GEODE_HANDLER(IntegerControl, HandleMouseWheel));
+		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, GEODE_HANDLER(IntegerControl, HandleTextChanged));
+		SubscribeToEvent(lineEdit_, E_TEXTENTRY, GEODE_HANDLER(IntegerControl, HandleTextEntry));
 	}
 
 	void IntegerControl::RegisterObject(Context* context)
@@ -892,8 +893,8 @@ namespace Geode
 		yControl_ = CreateChild<IntegerControl>("VC_YControl");
 		yControl_->SetInternal(true);
 
-		SubscribeToEvent(xControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntVector2Control, HandleXControlChanged));
-		SubscribeToEvent(yControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntVector2Control, HandleYControlChanged));
+		SubscribeToEvent(xControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntVector2Control, HandleXControlChanged));
+		SubscribeToEvent(yControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntVector2Control, HandleYControlChanged));
 	}
 
 	void IntVector2Control::RegisterObject(Context* context)
@@ -961,9 +962,9 @@ namespace Geode
 		zControl_ = CreateChild<IntegerControl>("VC_ZControl");
 		zControl_->SetInternal(true);
 
-		SubscribeToEvent(xControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntVector3Control, HandleXControlChanged));
-		SubscribeToEvent(yControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntVector3Control, HandleYControlChanged));
-		SubscribeToEvent(zControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntVector3Control, HandleZControlChanged));
+		SubscribeToEvent(xControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntVector3Control, HandleXControlChanged));
+		SubscribeToEvent(yControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntVector3Control, HandleYControlChanged));
+		SubscribeToEvent(zControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntVector3Control, HandleZControlChanged));
 	}
 
 	void IntVector3Control::RegisterObject(Context* context)
@@ -1046,10 +1047,10 @@ namespace Geode
 		bottomControl_ = CreateChild<IntegerControl>("RC_BottomControl");
 		bottomControl_->SetInternal(true);
 
-		SubscribeToEvent(leftControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntRectControl, HandleLeftControlChanged));
-		SubscribeToEvent(topControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntRectControl, HandleTopControlChanged));
-		SubscribeToEvent(rightControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntRectControl, HandleRightControlChanged));
-		SubscribeToEvent(bottomControl_, E_CONTROLCHANGED, URHO3D_HANDLER(IntRectControl, HandleBottomControlChanged));
+		SubscribeToEvent(leftControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntRectControl, HandleLeftControlChanged));
+		SubscribeToEvent(topControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntRectControl, HandleTopControlChanged));
+		SubscribeToEvent(rightControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntRectControl, HandleRightControlChanged));
+		SubscribeToEvent(bottomControl_, E_CONTROLCHANGED, GEODE_HANDLER(IntRectControl, HandleBottomControlChanged));
 	}
 
 	void IntRectControl::RegisterObject(Context* context)
@@ -1140,7 +1141,7 @@ namespace Geode
 		label_ = CreateChild<Text>("BC_Label");
 		label_->SetInternal(true);
 
-		SubscribeToEvent(checkBox_, E_TOGGLED, URHO3D_HANDLER(CheckboxControl, HandleCheckBoxToggled));
+		SubscribeToEvent(checkBox_, E_TOGGLED, GEODE_HANDLER(CheckboxControl, HandleCheckBoxToggled));
 	}
 
 	void CheckboxControl::RegisterObject(Context* context)
@@ -1213,7 +1214,7 @@ namespace Geode
 		label_ = CreateChild<Text>("RC_Label");
 		label_->SetInternal(true);
 
-		SubscribeToEvent(radio_, E_TOGGLED, URHO3D_HANDLER(RadioControl, HandleRadioToggled));
+		SubscribeToEvent(radio_, E_TOGGLED, GEODE_HANDLER(RadioControl, HandleRadioToggled));
 	}
 
 	void RadioControl::RegisterObject(Context* context)
@@ -1292,7 +1293,7 @@ namespace Geode
 		lineEdit_ = CreateChild<LineEdit>("SC_LineEdit");
 		lineEdit_->SetInternal(true);
 
-		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, URHO3D_HANDLER(StringControl, HandleTextChanged));
+		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, GEODE_HANDLER(StringControl, HandleTextChanged));
 	}
 
 	void StringControl::RegisterObject(Context* context)
@@ -1350,7 +1351,7 @@ namespace Geode
 		lineEdit_ = CreateChild<LineEdit>("SLC_LineEdit");
 		lineEdit_->SetInternal(true);
 
-		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, URHO3D_HANDLER(StringListControl, HandleTextChanged));
+		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, GEODE_HANDLER(StringListControl, HandleTextChanged));
 	}
 
 	void StringListControl::RegisterObject(Context* context)
@@ -1427,8 +1428,8 @@ namespace Geode
 		selectBtn_ = CreateChild<Button>("FC_SelectButton");
 		selectBtn_->SetInternal(true);
 
-		SubscribeToEvent(selectBtn_, E_RELEASED, URHO3D_HANDLER(FileControl, HandleSelectButtonReleased));
-		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, URHO3D_HANDLER(FileControl, HandleTextChanged));
+		SubscribeToEvent(selectBtn_, E_RELEASED, GEODE_HANDLER(FileControl, HandleSelectButtonReleased));
+		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, GEODE_HANDLER(FileControl, HandleTextChanged));
 	}
 
 	void FileControl::RegisterObject(Context* context)
@@ -1481,7 +1482,7 @@ namespace Geode
 		fileSelector_->SetTitle("Select File");
 		fileSelector_->SetButtonTexts("SELECT", "CANCEL");
 
-		SubscribeToEvent(fileSelector_, E_FILESELECTED, URHO3D_HANDLER(FileControl, HandleFileSelected));
+		SubscribeToEvent(fileSelector_, E_FILESELECTED, GEODE_HANDLER(FileControl, HandleFileSelected));
 	}
 
 	void FileControl::HandleFileSelected(StringHash, VariantMap& eventData)
@@ -1512,8 +1513,8 @@ namespace Geode
 		selectBtn_ = CreateChild<Button>("RRC_SelectBtn");
 		selectBtn_->SetInternal(true);
 
-		SubscribeToEvent(selectBtn_, E_RELEASED, URHO3D_HANDLER(ResourceRefControl, HandleSelectButtonReleased));
-		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, URHO3D_HANDLER(ResourceRefControl, HandleTextChanged));
+		SubscribeToEvent(selectBtn_, E_RELEASED, GEODE_HANDLER(ResourceRefControl, HandleSelectButtonReleased));
+		SubscribeToEvent(lineEdit_, E_TEXTCHANGED, GEODE_HANDLER(ResourceRefControl, HandleTextChanged));
 	}
 
 	void ResourceRefControl::RegisterObject(Context* context)
@@ -1568,7 +1569,7 @@ namespace Geode
 		fileSelector_->SetTitle("Select Resource");
 		fileSelector_->SetButtonTexts("SELECT", "CANCEL");
 
-		SubscribeToEvent(fileSelector_, E_FILESELECTED, URHO3D_HANDLER(ResourceRefControl, HandleFileSelected));
+		SubscribeToEvent(fileSelector_, E_FILESELECTED, GEODE_HANDLER(ResourceRefControl, HandleFileSelected));
 	}
 
 	void ResourceRefControl::HandleFileSelected(StringHash, VariantMap& eventData)
@@ -1596,7 +1597,7 @@ namespace Geode
 		dropDownList_ = CreateChild<DropDownList>("SC_DropDownList");
 		dropDownList_->SetInternal(true);
 
-		SubscribeToEvent(dropDownList_, E_ITEMSELECTED, URHO3D_HANDLER(SelectControl, HandleItemSelected));
+		SubscribeToEvent(dropDownList_, E_ITEMSELECTED, GEODE_HANDLER(SelectControl, HandleItemSelected));
 	}
 
 	SelectControl::~SelectControl()
@@ -1686,7 +1687,7 @@ namespace Geode
 		typeSelector_ = CreateChild<SelectControl>("VC_TypeSelector");
 		typeSelector_->SetInternal(true);
 
-		SubscribeToEvent(typeSelector_, E_CONTROLCHANGED, URHO3D_HANDLER(VariantControl, HandleTypeSelectorValueChanged));
+		SubscribeToEvent(typeSelector_, E_CONTROLCHANGED, GEODE_HANDLER(VariantControl, HandleTypeSelectorValueChanged));
 	}
 
 	void VariantControl::RegisterObject(Context* context)
@@ -1850,7 +1851,7 @@ namespace Geode
 
 		if (internalControl_ != nullptr)
 		{
-			SubscribeToEvent(internalControl_, E_CONTROLCHANGED, URHO3D_HANDLER(VariantControl, HandleInternalControlValueChanged));
+			SubscribeToEvent(internalControl_, E_CONTROLCHANGED, GEODE_HANDLER(VariantControl, HandleInternalControlValueChanged));
 		}
 	}
 
@@ -1909,7 +1910,7 @@ namespace Geode
 		items_ = CreateChild<UIElement>("VMC_Items");
 		items_->SetInternal(true);
 
-		SubscribeToEvent(newBtn_, E_RELEASED, URHO3D_HANDLER(VariantMapControl, HandleNewButtonReleased));
+		SubscribeToEvent(newBtn_, E_RELEASED, GEODE_HANDLER(VariantMapControl, HandleNewButtonReleased));
 	}
 
 	void VariantMapControl::RegisterObject(Context* context)
@@ -1995,8 +1996,8 @@ namespace Geode
 		variantControl->SetValue(variant);
 		variantControl->SetVar(VAR_VARIANTMAP_ITEM_KEY, key);
 
-		SubscribeToEvent(deleteButton, E_RELEASED, URHO3D_HANDLER(VariantMapControl, HandleItemDeleteButtonReleased));
-		SubscribeToEvent(variantControl, E_CONTROLCHANGED, URHO3D_HANDLER(VariantMapControl, HandleVariantControlValueChanged));
+		SubscribeToEvent(deleteButton, E_RELEASED, GEODE_HANDLER(VariantMapControl, HandleItemDeleteButtonReleased));
+		SubscribeToEvent(variantControl, E_CONTROLCHANGED, GEODE_HANDLER(VariantMapControl, HandleVariantControlValueChanged));
 	}
 
 	///------------------------------------------------------------------------------------------------
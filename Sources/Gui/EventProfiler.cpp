@@ -0,0 +1,177 @@
+#include "EventProfiler.h"
+#include "TraceRecorder.h"
+
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Container/Ptr.h>
+#include <Urho3D/Container/Sort.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/Resource/JSONFile.h>
+
+using namespace Urho3D;
+
+namespace Geode
+{
+	/// Forward the event to the wrapped handler, and time it while profiling or tracing.
+	class ProfiledEventHandler : public EventHandler
+	{
+	public:
+		ProfiledEventHandler(Object* receiver, EventHandler* handler, EventProfiler* profiler) : EventHandler(receiver)
+		{
+			handler_ = handler;
+			profiler_ = profiler;
+		}
+
+		void Invoke(VariantMap& eventData) override
+		{
+			auto recorder = TraceRecorder::GetActive();
+			handler_->SetSenderAndEventType(sender_, eventType_);
+
+			if ((profiler_.Null() || !profiler_->IsEnabled()) && recorder == nullptr)
+			{
+				handler_->Invoke(eventData);
+				return;
+			}
+
+			// Handlers may unsubscribe themselves or delete their receiver, so nothing is read from them after the call.
+			auto profiler = profiler_.Get();
+			auto eventType = eventType_;
+			auto receiverType = receiver_->GetTypeInfo();
+			auto start = recorder != nullptr ? recorder->GetTime() : 0;
+			HiresTimer timer;
+
+			handler_->Invoke(eventData);
+
+			auto elapsed = timer.GetUSec(false);
+
+			if (profiler != nullptr && profiler->IsEnabled())
+			{
+				profiler->AddHandlerTime(eventType, receiverType, elapsed);
+			}
+
+			if (recorder != nullptr)
+			{
+				recorder->AddEvent(receiverType->GetTypeName() + "::" + EventProfiler::GetEventName(eventType), "event", start, elapsed);
+			}
+		}
+
+		EventHandler* Clone() const override
+		{
+			return new ProfiledEventHandler(receiver_, handler_->Clone(), profiler_.Get());
+		}
+
+	private:
+		UniquePtr<EventHandler> handler_;
+		WeakPtr<EventProfiler> profiler_;
+	};
+
+	EventProfiler::EventProfiler(Context* context) : Object(context)
+	{
+		enabled_ = false;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	void EventProfiler::SetEnabled(bool enabled)
+	{
+		enabled_ = enabled;
+	}
+
+	bool EventProfiler::IsEnabled() const
+	{
+		return enabled_;
+	}
+
+	void EventProfiler::GetEntries(PODVector<const Entry*>& dest) const
+	{
+		dest.Clear();
+
+		for (auto& entry : entries_)
+		{
+			dest.Push(&entry.second_);
+		}
+
+		// Most expensive subscribers first.
+		Sort(dest.Begin(), dest.End(), [](const Entry* a, const Entry* b) { return a->time > b->time; });
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	void EventProfiler::AddHandlerTime(StringHash eventType, const TypeInfo* receiverType, long long usec)
+	{
+		auto key = ((unsigned long long)eventType.Value() << 32) | receiverType->GetType().Value();
+		auto entryIt = entries_.Find(key);
+
+		if (entryIt == entries_.End())
+		{
+			Entry entry;
+			entry.eventName = GetEventName(eventType);
+			entry.receiverName = receiverType->GetTypeName();
+			entry.count = 0;
+			entry.time = 0;
+			entry.maxTime = 0;
+			entryIt = entries_.Insert(MakePair(key, entry));
+		}
+
+		entryIt->second_.count++;
+		entryIt->second_.time += usec;
+		entryIt->second_.maxTime = Max(entryIt->second_.maxTime, usec);
+	}
+
+	void EventProfiler::Clear()
+	{
+		entries_.Clear();
+	}
+
+	bool EventProfiler::Save(const String& filename) const
+	{
+		PODVector<const Entry*> entries;
+		GetEntries(entries);
+
+		JSONFile json(context_);
+		JSONValue& root = json.GetRoot();
+		JSONValue handlers;
+
+		for (auto entry : entries)
+		{
+			JSONValue value;
+			value.Set("event", entry->eventName);
+			value.Set("receiver", entry->receiverName);
+			value.Set("count", entry->count);
+			value.Set("totalUs", (double)entry->time);
+			value.Set("meanUs", (double)entry->time / entry->count);
+			value.Set("maxUs", (double)entry->maxTime);
+			handlers.Push(value);
+		}
+
+		root.Set("version", 1);
+		root.Set("handlers", handlers);
+
+		File file(context_, filename, FILE_WRITE);
+		return file.IsOpen() && json.Save(file);
+	}
+
+	String EventProfiler::GetEventName(StringHash eventType)
+	{
+		auto eventName = eventType.Reverse();
+
+		// Event names are only known when Urho3D is built with URHO3D_HASH_DEBUG.
+		return eventName.Empty() ? eventType.ToString() : eventName;
+	}
+
+	EventHandler* EventProfiler::CreateHandler(Object* receiver, EventHandler* handler)
+	{
+		auto profiler = receiver->GetSubsystem<EventProfiler>();
+
+		// Without profiler nor trace recorder (benchmark, tools) handlers are subscribed as is.
+		if (profiler == nullptr && receiver->GetSubsystem<TraceRecorder>() == nullptr)
+		{
+			return handler;
+		}
+
+		return new ProfiledEventHandler(receiver, handler, profiler);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/**
+ * @file    EventProfiler.h
+ * @ingroup Gui
+ * @brief   Call count and time of event handlers per event type and subscriber class.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Container/HashMap.h>
+
+/// Drop-in replacement of URHO3D_HANDLER which reports the handler to the event profiler and trace recorder.
+#define GEODE_HANDLER(className, function) Geode::EventProfiler::CreateHandler(this, new Urho3D::EventHandlerImpl<className>(this, &className::function))
+
+namespace Geode
+{
+	class EventProfiler : public Urho3D::Object
+	{
+		URHO3D_OBJECT(EventProfiler, Urho3D::Object)
+
+	public:
+		struct Entry {
+			Urho3D::String eventName;
+			Urho3D::String receiverName;
+			unsigned count;
+			long long time;
+			long long maxTime;
+		};
+
+	public:
+		/// Constructors.
+		explicit EventProfiler(Urho3D::Context* context);
+
+		/// Accessors & Mutators.
+		void SetEnabled(bool enabled);
+		bool IsEnabled() const;
+		void GetEntries(Urho3D::PODVector<const Entry*>& dest) const;
+
+		/// Other methods.
+		void AddHandlerTime(Urho3D::StringHash eventType, const Urho3D::TypeInfo* receiverType, long long usec);
+		void Clear();
+		bool Save(const Urho3D::String& filename) const;
+		static Urho3D::String GetEventName(Urho3D::StringHash eventType);
+		static Urho3D::EventHandler* CreateHandler(Urho3D::Object* receiver, Urho3D::EventHandler* handler);
+
+	private:
+		bool enabled_;
+		Urho3D::HashMap<unsigned long long, Entry> entries_;
+	};
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "FlyMenu.h"
+#include "EventProfiler.h"
 
 #include <Urho3D/UI/Window.h>
 #include <Urho3D/UI/Text.h>
@@ -38,7 +39,7 @@ namespace Geode
 		label->SetText(text);
 		label->SetStyle("FlyMenuButtonText");
 
-		SubscribeToEvent(btn, E_CLICKEND, URHO3D_HANDLER(FlyMenu, HandleItemClickEnd));
+		SubscribeToEvent(btn, E_CLICKEND, GEODE_HANDLER(FlyMenu, HandleItemClickEnd));
 
 		return btn;
 	}
@@ -52,7 +53,7 @@ namespace Geode
 		label->SetText(text);
 		label->SetStyle("FlyMenuToggleText");
 
-		SubscribeToEvent(toggle, E_CLICKEND, URHO3D_HANDLER(FlyMenu, HandleItemClickEnd));
+		SubscribeToEvent(toggle, E_CLICKEND, GEODE_HANDLER(FlyMenu, HandleItemClickEnd));
 
 		return toggle;
 	}
@@ -1,4 +1,11 @@
 #include "Helper.h"
+#include "Controls.h"
+#include "FlyMenu.h"
+#include "MenuBar.h"
+#include "Radio.h"
+#include "ReactiveForm.h"
+#include "TabBar.h"
+#include "Toolbar.h"
 
 #include <Urho3D/UI/ToolTip.h>
 #include <Urho3D/UI/Text.h>
@@ -42,4 +49,36 @@ namespace Geode
 		element->SetEditable(false);
 		element->SetOpacity(0.5);
 	}
+
+	void Helper::RegisterObjects(Context* context)
+	{
+		FloatControl::RegisterObject(context);
+		QuaternionControl::RegisterObject(context);
+		Vector2Control::RegisterObject(context);
+		Vector3Control::RegisterObject(context);
+		Vector4Control::RegisterObject(context);
+		RectControl::RegisterObject(context);
+		ColorControl::RegisterObject(context);
+		IntegerControl::RegisterObject(context);
+		IntVector2Control::RegisterObject(context);
+		IntVector3Control::RegisterObject(context);
+		IntRectControl::RegisterObject(context);
+		CheckboxControl::RegisterObject(context);
+		RadioControl::RegisterObject(context);
+		StringControl::RegisterObject(context);
+		StringListControl::RegisterObject(context);
+		FileControl::RegisterObject(context);
+		ResourceRefControl::RegisterObject(context);
+		SelectControl::RegisterObject(context);
+		VariantControl::RegisterObject(context);
+		VariantMapControl::RegisterObject(context);
+
+		FlyMenu::RegisterObject(context);
+		MenuBar::RegisterObject(context);
+		Radio::RegisterObject(context);
+		AttributeField::RegisterObject(context);
+		ReactiveForm::RegisterObject(context);
+		TabBar::RegisterObject(context);
+		ToolBar::RegisterObject(context);
+	}
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <Urho3D/Core/Context.h>
 #include <Urho3D/UI/UIElement.h>
 #include <Urho3D/UI/BorderImage.h>
 #include <Urho3D/UI/ToolTip.h>
@@ -26,5 +27,8 @@ namespace Geode
 	public:
 		static void	Sensitive(Urho3D::UIElement* element);
 		static void	Unsensitive(Urho3D::UIElement* element);
+
+	public:
+		static void RegisterObjects(Urho3D::Context* context);
 	};
 }
\ No newline at end of file
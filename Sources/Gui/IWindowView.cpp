@@ -1,4 +1,5 @@
 #include "IWindowView.h"
+#include "EventProfiler.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/UI/UIEvents.h>
@@ -28,10 +29,10 @@ namespace Geode
 
 		win_->BringToFront();
 
-		SubscribeToEvent(win_, E_DRAGBEGIN, URHO3D_HANDLER(IWindowView, HandleDragBegin));
-		SubscribeToEvent(win_, E_DRAGMOVE, URHO3D_HANDLER(IWindowView, HandleDragMove));
-		SubscribeToEvent(win_, E_DRAGEND, URHO3D_HANDLER(IWindowView, HandleDragEnd));
-		SubscribeToEvent(closeButton_, E_RELEASED, URHO3D_HANDLER(IWindowView, HandleCloseButton));
+		SubscribeToEvent(win_, E_DRAGBEGIN, GEODE_HANDLER(IWindowView, HandleDragBegin));
+		SubscribeToEvent(win_, E_DRAGMOVE, GEODE_HANDLER(IWindowView, HandleDragMove));
+		SubscribeToEvent(win_, E_DRAGEND, GEODE_HANDLER(IWindowView, HandleDragEnd));
+		SubscribeToEvent(closeButton_, E_RELEASED, GEODE_HANDLER(IWindowView, HandleCloseButton));
 	}
 
 	const String& IWindowView::GetTitle() const
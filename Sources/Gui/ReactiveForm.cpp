@@ -1,4 +1,6 @@
 #include "ReactiveForm.h"
+#include "EventProfiler.h"
+#include "TraceRecorder.h"
 
 #include <Urho3D/Core/CoreEvents.h>
 
@@ -11,7 +13,7 @@ namespace Geode
 		label_ = CreateChild<Text>("AF_Label");
 		label_->SetInternal(true);
 
-		SubscribeToEvent(E_UPDATE, URHO3D_HANDLER(AttributeField, HandleUpdate));
+		SubscribeToEvent(E_UPDATE, GEODE_HANDLER(AttributeField, HandleUpdate));
 	}
 
 	void AttributeField::RegisterObject(Context* context)
@@ -32,6 +34,8 @@ namespace Geode
 
 	void AttributeField::SetAttribute(Serializable* serializable, const String& attributeName)
 	{
+		GEODE_TRACE("AttributeField::SetAttribute", "ui");
+
 		if (control_)
 		{
 			UnsubscribeFromEvent(control_, E_CONTROLCHANGED);
@@ -160,7 +164,7 @@ namespace Geode
 
 		if (control_ != nullptr)
 		{
-			SubscribeToEvent(control_, E_CONTROLCHANGED, URHO3D_HANDLER(AttributeField, HandleControlChanged));
+			SubscribeToEvent(control_, E_CONTROLCHANGED, GEODE_HANDLER(AttributeField, HandleControlChanged));
 		}
 
 		serializable_ = serializable;
@@ -219,6 +223,8 @@ namespace Geode
 
 	void AttributeField::HandleUpdate(StringHash, VariantMap&)
 	{
+		GEODE_TRACE("AttributeField::HandleUpdate", "ui");
+
 		if (activated_ == false || bidirectionnalBinding_ == false || serializable_ == nullptr || control_ == nullptr || control_->IsEditing())
 		{
 			return;
@@ -355,6 +361,8 @@ namespace Geode
 
 	AttributeField* ReactiveForm::AddAttributeField(Serializable* serializable, String attributeName, String label)
 	{
+		GEODE_TRACE("ReactiveForm::AddAttributeField", "ui");
+
 		auto attrField = CreateChild<AttributeField>("RF_AttributeField" + attributeName);
 		attrField->SetStyleAuto();
 		attrField->SetAttribute(serializable, attributeName);
@@ -362,13 +370,15 @@ namespace Geode
 
 		attrFields_.Push(attrField);
 
-		SubscribeToEvent(attrField, E_ATTRIBUTEFIELD_DATACHANGED, URHO3D_HANDLER(ReactiveForm, HandleAttributeFieldDataChanged));
+		SubscribeToEvent(attrField, E_ATTRIBUTEFIELD_DATACHANGED, GEODE_HANDLER(ReactiveForm, HandleAttributeFieldDataChanged));
 
 		return attrField;
 	}
 
 	void ReactiveForm::Clear()
 	{
+		GEODE_TRACE("ReactiveForm::Clear", "ui");
+
 		attrFields_.Clear();
 		RemoveAllChildren();
 	}
@@ -1,4 +1,5 @@
 #include "TabBar.h"
+#include "EventProfiler.h"
 
 #include <Urho3D/UI/ToolTip.h>
 #include <Urho3D/UI/Text.h>
@@ -186,7 +187,7 @@ namespace Geode
 			CreateCloseButton(tab);
 		}
 
-		SubscribeToEvent(tab, E_TOGGLED, URHO3D_HANDLER(TabBar, HandleTabToggled));
+		SubscribeToEvent(tab, E_TOGGLED, GEODE_HANDLER(TabBar, HandleTabToggled));
 
 		return tab;
 	}
@@ -207,7 +208,7 @@ namespace Geode
 		auto closeButton = parent->CreateChild<Button>("CloseButton");
 		closeButton->SetStyle("TabBarTabItemCloseButton");
 
-		SubscribeToEvent(closeButton, E_RELEASED, URHO3D_HANDLER(TabBar, HandleTabCloseButtonReleased));
+		SubscribeToEvent(closeButton, E_RELEASED, GEODE_HANDLER(TabBar, HandleTabCloseButtonReleased));
 	}
 
 	///------------------------------------------------------------------------------------------------
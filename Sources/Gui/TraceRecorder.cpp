@@ -0,0 +1,177 @@
+#include "TraceRecorder.h"
+#include "EventProfiler.h"
+
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/Resource/JSONFile.h>
+
+using namespace Urho3D;
+
+/// Scopes sit in hot paths, they must find out whether a capture runs without any lookup.
+static Geode::TraceRecorder* activeRecorder = nullptr;
+
+namespace Geode
+{
+	TraceRecorder::TraceRecorder(Context* context) : Object(context)
+	{
+		recording_ = false;
+		numFrames_ = 0;
+		frameNumber_ = 0;
+		frameStart_ = 0;
+
+		SubscribeToEvent(E_BEGINFRAME, GEODE_HANDLER(TraceRecorder, HandleBeginFrame));
+	}
+
+	TraceRecorder::~TraceRecorder()
+	{
+		if (activeRecorder == this)
+		{
+			activeRecorder = nullptr;
+		}
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  ACCESSORS & MUTATORS
+	///------------------------------------------------------------------------------------------------
+
+	bool TraceRecorder::IsRecording() const
+	{
+		return recording_;
+	}
+
+	long long TraceRecorder::GetTime() const
+	{
+		return clock_.GetUSec(false);
+	}
+
+	TraceRecorder* TraceRecorder::GetActive()
+	{
+		return activeRecorder;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  OTHER METHODS
+	///------------------------------------------------------------------------------------------------
+
+	bool TraceRecorder::Start(unsigned numFrames, const String& filename)
+	{
+		if (recording_ || activeRecorder != nullptr || numFrames == 0)
+		{
+			return false;
+		}
+
+		recording_ = true;
+		numFrames_ = numFrames;
+		frameNumber_ = 0;
+		filename_ = filename;
+		events_.Clear();
+		clock_.Reset();
+		frameStart_ = 0;
+		activeRecorder = this;
+
+		return true;
+	}
+
+	bool TraceRecorder::Stop()
+	{
+		if (!recording_)
+		{
+			return false;
+		}
+
+		AddEvent("Frame " + String(frameNumber_), "frame", frameStart_, GetTime() - frameStart_);
+
+		recording_ = false;
+		activeRecorder = nullptr;
+
+		auto saved = Save(filename_);
+		events_.Clear();
+
+		return saved;
+	}
+
+	void TraceRecorder::AddEvent(const String& name, const char* category, long long start, long long duration)
+	{
+		if (!recording_)
+		{
+			return;
+		}
+
+		Event event;
+		event.name = name;
+		event.category = category;
+		event.start = start;
+		event.duration = duration;
+		events_.Push(event);
+	}
+
+	bool TraceRecorder::Save(const String& filename) const
+	{
+		JSONFile json(context_);
+		JSONValue& root = json.GetRoot();
+		JSONValue traceEvents;
+
+		// Complete events ("X") nest by time range, the viewer rebuilds the call stacks.
+		for (auto& event : events_)
+		{
+			JSONValue value;
+			value.Set("name", event.name);
+			value.Set("cat", event.category);
+			value.Set("ph", "X");
+			value.Set("ts", (double)event.start);
+			value.Set("dur", (double)event.duration);
+			value.Set("pid", 1);
+			value.Set("tid", 1);
+			traceEvents.Push(value);
+		}
+
+		root.Set("traceEvents", traceEvents);
+		root.Set("displayTimeUnit", "ms");
+
+		File file(context_, filename, FILE_WRITE);
+		return file.IsOpen() && json.Save(file);
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  EVENT HANDLERS
+	///------------------------------------------------------------------------------------------------
+
+	void TraceRecorder::HandleBeginFrame(StringHash, VariantMap&)
+	{
+		if (!recording_)
+		{
+			return;
+		}
+
+		if (frameNumber_ + 1 >= numFrames_)
+		{
+			Stop();
+			return;
+		}
+
+		auto now = GetTime();
+		AddEvent("Frame " + String(frameNumber_), "frame", frameStart_, now - frameStart_);
+		frameStart_ = now;
+		frameNumber_++;
+	}
+
+	///------------------------------------------------------------------------------------------------
+	///  TRACE SCOPE
+	///------------------------------------------------------------------------------------------------
+
+	TraceScope::TraceScope(const char* name, const char* category)
+	{
+		recorder_ = TraceRecorder::GetActive();
+		name_ = name;
+		category_ = category;
+		start_ = recorder_ != nullptr ? recorder_->GetTime() : 0;
+	}
+
+	TraceScope::~TraceScope()
+	{
+		if (recorder_ != nullptr)
+		{
+			recorder_->AddEvent(name_, category_, start_, recorder_->GetTime() - start_);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**
+ * @file    TraceRecorder.h
+ * @ingroup Gui
+ * @brief   Records editor frames as a Chrome trace-event file.
+ *
+ * Copyright (c) 2018 AntiLoxy (rootofgeno@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/Timer.h>
+
+/// Trace the enclosing scope under the given name and category while a capture is running.
+#define GEODE_TRACE(name, category) Geode::TraceScope traceScope_(name, category)
+
+namespace Geode
+{
+	class TraceRecorder : public Urho3D::Object
+	{
+		URHO3D_OBJECT(TraceRecorder, Urho3D::Object)
+
+		struct Event {
+			Urho3D::String name;
+			const char* category;
+			long long start;
+			long long duration;
+		};
+
+	public:
+		/// Constructors.
+		explicit TraceRecorder(Urho3D::Context* context);
+		~TraceRecorder();
+
+		/// Accessors & Mutators.
+		bool IsRecording() const;
+		long long GetTime() const;
+		static TraceRecorder* GetActive();
+
+		/// Other methods.
+		bool Start(unsigned numFrames, const Urho3D::String& filename);
+		bool Stop();
+		void AddEvent(const Urho3D::String& name, const char* category, long long start, long long duration);
+
+	private:
+		/// Event handlers.
+		void HandleBeginFrame(Urho3D::StringHash eventType, Urho3D::VariantMap& eventData);
+
+		/// Other methods.
+		bool Save(const Urho3D::String& filename) const;
+
+	private:
+		bool recording_;
+		unsigned numFrames_;
+		unsigned frameNumber_;
+		long long frameStart_;
+		Urho3D::String filename_;
+		Urho3D::HiresTimer clock_;
+		Urho3D::Vector<Event> events_;
+	};
+
+	class TraceScope
+	{
+	public:
+		/// Constructors.
+		TraceScope(const char* name, const char* category);
+		~TraceScope();
+
+	private:
+		Geode::TraceRecorder* recorder_;
+		const char* name_;
+		const char* category_;
+		long long start_;
+	};
+}
\ No newline at end of file
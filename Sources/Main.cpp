@@ -1,8 +1,16 @@
 #include "Main.h"
+#include "Editor/EditorProfiler.h"
+#include "Editor/IdleMonitor.h"
+#include "Editor/CollisionGenerator.h"
+#include "Editor/EditorScene.h"
+#include "Editor/SceneGenerator.h"
+#include "Editor/SpriteOutline.h"
 #include "Gui/ContextMenu.h"
 #include "Gui/Controls.h"
+#include "Gui/EventProfiler.h"
 #include "Gui/FlyMenu.h"
 #include "Gui/GuiEvents.h"
+#include "Gui/Helper.h"
 #include "Gui/IView.h"
 #include "Gui/IWindowView.h"
 #include "Gui/MenuBar.h"
@@ -10,6 +18,7 @@
 #include "Gui/ReactiveForm.h"
 #include "Gui/TabBar.h"
 #include "Gui/ToolBar.h"
+#include "Gui/TraceRecorder.h"
 
 #include <Urho3D/UI/UI.h>
 #include <Urho3D/Graphics/Graphics.h>
@@ -18,14 +27,21 @@
 #include <Urho3D/Resource/ResourceCache.h>
 #include <Urho3D/UI/Cursor.h>
 #include <Urho3D/Input/Input.h>
+#include <Urho3D/Engine/Engine.h>
 
 using namespace Urho3D;
 using namespace Geode;
 
 static const String WINDOW_TITLE = "Geode";
+static const unsigned DEFAULT_TRACE_NUM_FRAMES = 300;
 
 Main::Main(Context* context) : Application(context)
-{}
+{
+	generateNumNodes_ = 1000;
+	generateSeed_ = 1;
+	generateMaxDepth_ = 1;
+	traceNumFrames_ = DEFAULT_TRACE_NUM_FRAMES;
+}
 
 void Main::Setup()
 {
@@ -39,10 +55,30 @@ void Main::Setup()
     {
         engineParameters_[EP_RESOURCE_PREFIX_PATHS] = ";Resources";
     }
+
+	ParseArguments();
+
+	// Scene and collision generation run without window, the editor is not started.
+	if (!generateFilename_.Empty() || !collisionFilename_.Empty())
+	{
+		engineParameters_[EP_HEADLESS] = true;
+	}
 }
 
 void Main::Start()
 {
+	if (!generateFilename_.Empty())
+	{
+		GenerateScene();
+		return;
+	}
+
+	if (!collisionFilename_.Empty())
+	{
+		GenerateCollision();
+		return;
+	}
+
 	auto uiRoot = GetSubsystem<UI>()->GetRoot();
 	uiRoot->SetDefaultStyle(GetSubsystem<ResourceCache>()->GetResource<XMLFile>("UI/DefaultStyle.xml"));
 
@@ -51,6 +87,12 @@ void Main::Start()
 
 	RegisterObjects();
 
+	// Started before the editor is built so the startup frames are part of the capture.
+	if (!traceFilename_.Empty())
+	{
+		GetSubsystem<TraceRecorder>()->Start(traceNumFrames_, traceFilename_);
+	}
+
 	editorView_ = MakeShared<EditorView>(context_);
 }
 
@@ -61,34 +103,105 @@ void Main::Stop()
 
 void Main::RegisterObjects()
 {
-    FloatControl::RegisterObject(context_);
-    QuaternionControl::RegisterObject(context_);
-    Vector2Control::RegisterObject(context_);
-    Vector3Control::RegisterObject(context_);
-    Vector4Control::RegisterObject(context_);
-    RectControl::RegisterObject(context_);
-    ColorControl::RegisterObject(context_);
-    IntegerControl::RegisterObject(context_);
-    IntVector2Control::RegisterObject(context_);
-    IntVector3Control::RegisterObject(context_);
-    IntRectControl::RegisterObject(context_);
-    CheckboxControl::RegisterObject(context_);
-    RadioControl::RegisterObject(context_);
-    StringControl::RegisterObject(context_);
-    StringListControl::RegisterObject(context_);
-    FileControl::RegisterObject(context_);
-    ResourceRefControl::RegisterObject(context_);
-    SelectControl::RegisterObject(context_);
-    VariantControl::RegisterObject(context_);
-    VariantMapControl::RegisterObject(context_);
-
-    FlyMenu::RegisterObject(context_);
-    MenuBar::RegisterObject(context_);
-    Radio::RegisterObject(context_);
-    AttributeField::RegisterObject(context_);
-    ReactiveForm::RegisterObject(context_);
-    TabBar::RegisterObject(context_);
-    ToolBar::RegisterObject(context_);
+    Helper::RegisterObjects(context_);
+    context_->RegisterSubsystem(new EditorProfiler(context_));
+    context_->RegisterSubsystem(new EventProfiler(context_));
+    context_->RegisterSubsystem(new TraceRecorder(context_));
+    context_->RegisterSubsystem(new IdleMonitor(context_));
+    context_->RegisterSubsystem(new SpriteOutline(context_));
+}
+
+void Main::ParseArguments()
+{
+	auto arguments = GetArguments();
+
+	for (unsigned i = 0; i + 1 < arguments.Size(); i++)
+	{
+		auto argument = arguments[i].ToLower();
+		auto value = arguments[i + 1];
+
+		if (argument == "-generate")
+		{
+			generateFilename_ = value;
+			i++;
+		}
+		else if (argument == "-nodes")
+		{
+			generateNumNodes_ = ToUInt(value);
+			i++;
+		}
+		else if (argument == "-seed")
+		{
+			generateSeed_ = ToUInt(value);
+			i++;
+		}
+		else if (argument == "-depth")
+		{
+			generateMaxDepth_ = ToUInt(value);
+			i++;
+		}
+		else if (argument == "-collision")
+		{
+			collisionFilename_ = value;
+			i++;
+		}
+		else if (argument == "-trace")
+		{
+			traceFilename_ = value;
+			i++;
+		}
+		else if (argument == "-traceframes")
+		{
+			traceNumFrames_ = ToUInt(value);
+			i++;
+		}
+	}
+}
+
+void Main::GenerateScene()
+{
+	auto generator = MakeShared<SceneGenerator>(context_);
+	generator->SetNumNodes(generateNumNodes_);
+	generator->SetSeed(generateSeed_);
+	generator->SetMaxDepth(generateMaxDepth_);
+
+	if (!generator->Save(generateFilename_))
+	{
+		ErrorExit("Failed to generate scene " + generateFilename_);
+		return;
+	}
+
+	engine_->Exit();
+}
+
+void Main::GenerateCollision()
+{
+	RegisterObjects();
+	EditorScene::RegisterObject(context_);
+
+	auto editorScene = MakeShared<EditorScene>(context_);
+	auto generator = MakeShared<CollisionGenerator>(context_);
+
+	// Applied as in the editor, then written back in place. Throughput goes to the log.
+	if (!editorScene->Load(collisionFilename_))
+	{
+		ErrorExit("Failed to load scene " + collisionFilename_);
+		return;
+	}
+
+	if (!generator->Generate(editorScene)->Exec())
+	{
+		ErrorExit("No collision generated for " + collisionFilename_);
+		return;
+	}
+
+	if (!editorScene->Save(collisionFilename_))
+	{
+		ErrorExit("Failed to save scene " + collisionFilename_);
+		return;
+	}
+
+	engine_->Exit();
 }
 
 void Main::InitWindowTitleAndIcon()
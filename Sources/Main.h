@@ -17,6 +17,9 @@ public:
 
 private:
     void RegisterObjects();
+	void ParseArguments();
+	void GenerateScene();
+	void GenerateCollision();
 
     void InitWindowTitleAndIcon();
 	void InitCursor();
@@ -24,4 +27,11 @@ private:
 private:
 	Urho3D::SharedPtr<Urho3D::Cursor> cursor_;
 	Urho3D::SharedPtr<Geode::EditorView> editorView_;
+	Urho3D::String generateFilename_;
+	unsigned generateNumNodes_;
+	unsigned generateSeed_;
+	unsigned generateMaxDepth_;
+	Urho3D::String collisionFilename_;
+	Urho3D::String traceFilename_;
+	unsigned traceNumFrames_;
 };